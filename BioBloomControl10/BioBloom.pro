@@ -0,0 +1,33 @@
+#-------------------------------------------------
+#
+# Builds BioBloomCore first, then everything that links it, plus the
+# hub stand-in used to run them without the Pi and benchmark them.
+# "make check" runs BioBloomCore's unit tests
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    core \
+    app \
+    headless \
+    standin \
+    bench \
+    tests
+
+core.subdir = BioBloomCore
+
+app.file = BioBloomControl.pro
+app.depends = core
+
+headless.subdir = BioBloomHeadless
+headless.depends = core
+
+standin.subdir = HubStandIn
+
+bench.subdir = BioBloomBench
+bench.depends = core standin
+
+tests.subdir = BioBloomTests
+tests.depends = core
@@ -0,0 +1,35 @@
+#-------------------------------------------------
+#
+# Fleet load benchmark: runs BioBloomCore's engine against a HubStandIn
+# with a chosen number of pots and hub latency, and writes throughput,
+# update latency, CPU time, threads and peak memory as JSON
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += network
+QT       -= gui
+
+TARGET = BioBloomBench
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../BioBloomCore/BioBloomCore.pri)
+
+# Results carry the commit they were built from so runs can be compared
+BIOBLOOM_COMMIT = $$system(git -C $$shell_quote($$PWD) rev-parse --short HEAD)
+!isEmpty(BIOBLOOM_COMMIT): DEFINES += BIOBLOOM_COMMIT=\\\"$$BIOBLOOM_COMMIT\\\"
+
+win32: LIBS += -lpsapi
+
+SOURCES += \
+        main.cpp \
+    fleetbenchmark.cpp \
+    processusage.cpp \
+
+HEADERS += \
+    fleetbenchmark.h \
+    processusage.h \
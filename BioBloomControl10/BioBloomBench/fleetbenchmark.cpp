@@ -0,0 +1,390 @@
+/*                  Header File                 */
+#include "fleetbenchmark.h"
+#include "metricsregistry.h"
+#include <QCoreApplication>
+#include <QSettings>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QHostAddress>
+#include <QProcessEnvironment>
+#include <QThread>
+#include <QTimer>
+#include <QFileInfo>
+#include <QDir>
+#include <QSysInfo>
+#include <QDebug>
+#include <algorithm>
+
+static const int standInStartTimeout = 15000;          //Milliseconds for the stand-in to start listening
+static const int loadTimeout = 60000;                  //Milliseconds for ribbon_boot to list every pot
+
+/*          Constructor and Destructor          */
+FleetBenchmark::FleetBenchmark(QObject *parent) : QObject(parent)
+{
+    unitCount = 100;
+    hubLatency = 0;
+    pollInterval = 15;
+    rowInterval = 0;
+    pushUpdatesFlag = false;
+    warmupSeconds = 15;
+    durationSeconds = 60;
+
+    standInProcess = NULL;
+    fleetControllerAddress = NULL;
+    loadedFlag = false;
+    measuringFlag = false;
+
+    startRequests = 0;
+    startErrors = 0;
+    startReadings = 0;
+}
+
+FleetBenchmark::~FleetBenchmark()
+{
+    if(standInProcess)
+    {
+        standInProcess->kill();
+        standInProcess->waitForFinished(3000);
+    }
+}
+
+
+
+/*          Configuration Mutator Methods       */
+void FleetBenchmark::setUnitCount(int inputUnits)
+{
+    unitCount = qMax(1, inputUnits);
+}
+
+void FleetBenchmark::setHubLatency(int inputLatency)
+{
+    hubLatency = qMax(0, inputLatency);
+}
+
+void FleetBenchmark::setPollInterval(int inputSeconds)
+{
+    pollInterval = qMax(1, inputSeconds);
+}
+
+void FleetBenchmark::setRowInterval(int inputInterval)
+{
+    rowInterval = qMax(0, inputInterval);
+}
+
+void FleetBenchmark::setPushUpdates(bool inputPushFlag)
+{
+    pushUpdatesFlag = inputPushFlag;
+}
+
+void FleetBenchmark::setWarmup(int inputSeconds)
+{
+    warmupSeconds = qMax(0, inputSeconds);
+}
+
+void FleetBenchmark::setDuration(int inputSeconds)
+{
+    durationSeconds = qMax(1, inputSeconds);
+}
+
+void FleetBenchmark::setStandInPath(QString inputPath)
+{
+    standInPath = inputPath;
+}
+
+void FleetBenchmark::setHubUrl(QUrl inputUrl)
+{
+    hubUrl = inputUrl;
+}
+
+
+
+/*              Class Methods                   */
+bool FleetBenchmark::start()
+{
+    if(hubUrl.isEmpty() && !launchStandIn())
+        return false;
+
+    //The engine reads these as it is built, they go to the benchmark's own settings store
+    QSettings settings;
+    settings.setValue("polling/minimumIntervalSeconds", pollInterval);
+    settings.setValue("polling/maximumIntervalSeconds", pollInterval);
+    settings.setValue("hub/pushUpdates", pushUpdatesFlag);
+
+    HubClient::instance()->setHubUrl(hubUrl);
+
+    fleetControllerAddress = new FleetController(this);
+    connect(fleetControllerAddress, SIGNAL(unitCreated(BioBloomUnit*)), this, SLOT(unitCreatedSlot(BioBloomUnit*)));
+    connect(fleetControllerAddress, SIGNAL(unitsLoaded()), this, SLOT(unitsLoadedSlot()));
+
+    fleetControllerAddress->start();
+
+    QTimer::singleShot(loadTimeout, this, SLOT(loadTimeoutSlot()));
+
+    return true;
+}
+
+bool FleetBenchmark::launchStandIn()
+{
+    QString program = findStandIn();
+
+    if(program.isEmpty())
+    {
+        qCritical() << "HubStandIn not found, build it or pass --standin or --hub-url";
+        return false;
+    }
+
+    QTcpServer probe;                                                             //Let the system pick a free port
+    probe.listen(QHostAddress::LocalHost, 0);
+    quint16 port = probe.serverPort();
+    probe.close();
+
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert("QT_LOGGING_RULES", "*.debug=false");                     //Warnings still come through
+
+    standInProcess = new QProcess(this);
+    standInProcess->setProcessChannelMode(QProcess::ForwardedChannels);
+    standInProcess->setProcessEnvironment(environment);
+    standInProcess->start(program, QStringList() << "--port" << QString::number(port)
+                                                 << "--pots" << QString::number(unitCount)
+                                                 << "--interval" << QString::number(rowInterval)
+                                                 << "--latency" << QString::number(hubLatency));
+
+    if(!standInProcess->waitForStarted(standInStartTimeout))
+    {
+        qCritical() << "HubStandIn did not start:" << standInProcess->errorString();
+        return false;
+    }
+
+    //Ready once it accepts a connection; creating thousands of pots takes a moment
+    QElapsedTimer startClock;
+    startClock.start();
+    bool listeningFlag = false;
+
+    while(!listeningFlag && startClock.elapsed() < standInStartTimeout && standInProcess->state() == QProcess::Running)
+    {
+        QTcpSocket probeSocket;
+        probeSocket.connectToHost(QHostAddress::LocalHost, port);
+        listeningFlag = probeSocket.waitForConnected(500);
+
+        if(!listeningFlag)
+            QThread::msleep(100);
+    }
+
+    if(!listeningFlag)
+    {
+        qCritical() << "HubStandIn is not listening on port" << port;
+        return false;
+    }
+
+    hubUrl = QUrl(QString("http://127.0.0.1:%1/").arg(port));
+
+    return true;
+}
+
+QString FleetBenchmark::findStandIn()
+{
+    if(!standInPath.isEmpty())
+        return standInPath;
+
+    //Where BioBloom.pro builds it, next to this benchmark's own build directory
+    QDir applicationDirectory(QCoreApplication::applicationDirPath());
+    QStringList candidates;
+    candidates << "../HubStandIn/HubStandIn"
+               << "../../HubStandIn/release/HubStandIn.exe"
+               << "../../HubStandIn/debug/HubStandIn.exe"
+               << "../HubStandIn/HubStandIn.exe";
+
+    for(int i = 0; i < candidates.count(); i++)
+    {
+        QFileInfo candidate(applicationDirectory.filePath(candidates[i]));
+
+        if(candidate.isFile() && candidate.isExecutable())
+            return candidate.absoluteFilePath();
+    }
+
+    return QString();
+}
+
+void FleetBenchmark::finish(QString inputError)
+{
+    measuringFlag = false;
+
+    if(fleetControllerAddress)
+        fleetControllerAddress->stop();
+
+    HubClient::instance()->abortAll();
+
+    if(!inputError.isEmpty())
+        result.insert("error", inputError);
+
+    emit finished();
+}
+
+QJsonObject FleetBenchmark::getResult()
+{
+    return result;
+}
+
+qint64 FleetBenchmark::completedRequests()
+{
+    MetricsRegistry* registry = MetricsRegistry::instance();
+    QStringList names = registry->histogramNames();
+    qint64 completed = 0;
+
+    for(int i = 0; i < names.count(); i++)
+        if(names[i].startsWith("hub.") && names[i].endsWith(".latencyMs"))      //One sample per request that finished
+            completed += registry->histogram(names[i]).count();
+
+    return completed;
+}
+
+qint64 FleetBenchmark::failedRequests()
+{
+    MetricsRegistry* registry = MetricsRegistry::instance();
+    QStringList names = registry->counterNames();
+    qint64 failed = 0;
+
+    for(int i = 0; i < names.count(); i++)
+        if(names[i].startsWith("hub.") && names[i].endsWith(".errors"))
+            failed += registry->counter(names[i]);
+
+    return failed;
+}
+
+double FleetBenchmark::percentile(QVector<double> &sortedSamples, double fraction)
+{
+    if(sortedSamples.isEmpty())
+        return 0;
+
+    int index = qBound(0, (int)(fraction * sortedSamples.count() + 0.5) - 1, sortedSamples.count() - 1);      //Nearest rank
+
+    return sortedSamples[index];
+}
+
+
+
+/*              Class Slots                     */
+void FleetBenchmark::unitCreatedSlot(BioBloomUnit* unit)
+{
+    connect(unit, SIGNAL(updateCompleted(int,double)), this, SLOT(updateCompletedSlot(int,double)));
+}
+
+void FleetBenchmark::unitsLoadedSlot()
+{
+    if(loadedFlag)
+        return;
+
+    loadedFlag = true;
+    qInfo() << "Loaded" << fleetControllerAddress->getUnitCount() << "units, warming up for" << warmupSeconds << "seconds";
+
+    QTimer::singleShot(warmupSeconds * 1000, this, SLOT(measurementStartSlot()));
+}
+
+void FleetBenchmark::loadTimeoutSlot()
+{
+    if(!loadedFlag)
+        finish("hub did not list its pots in time");
+}
+
+void FleetBenchmark::measurementStartSlot()
+{
+    startUsage = ProcessUsage::current();
+    startRequests = completedRequests();
+    startErrors = failedRequests();
+    startReadings = MetricsRegistry::instance()->counter("units.readings");
+
+    updateSample.clear();
+    updateSample.reserve(unitCount * (durationSeconds / pollInterval + 2));
+
+    measuringFlag = true;
+    measurementClock.start();
+
+    QTimer::singleShot(durationSeconds * 1000, this, SLOT(measurementEndSlot()));
+}
+
+void FleetBenchmark::measurementEndSlot()
+{
+    double seconds = measurementClock.nsecsElapsed() / 1e9;
+    ProcessUsage endUsage = ProcessUsage::current();
+    qint64 requests = completedRequests() - startRequests;
+    qint64 errors = failedRequests() - startErrors;
+    qint64 readings = MetricsRegistry::instance()->counter("units.readings") - startReadings;
+
+    measuringFlag = false;
+
+    std::sort(updateSample.begin(), updateSample.end());
+
+    double updateSum = 0;
+    for(int i = 0; i < updateSample.count(); i++)
+        updateSum += updateSample[i];
+
+    QJsonObject build;
+    build.insert("qtVersion", QString(qVersion()));
+    build.insert("abi", QSysInfo::buildAbi());
+#ifdef BIOBLOOM_COMMIT
+    build.insert("commit", QString(BIOBLOOM_COMMIT));
+#endif
+#ifdef QT_DEBUG
+    build.insert("debug", true);
+#else
+    build.insert("debug", false);
+#endif
+
+    QJsonObject configuration;
+    configuration.insert("units", unitCount);
+    configuration.insert("hubLatencyMs", hubLatency);
+    configuration.insert("pollSeconds", pollInterval);
+    configuration.insert("rowIntervalMs", rowInterval);
+    configuration.insert("pushUpdates", pushUpdatesFlag);
+    configuration.insert("warmupSeconds", warmupSeconds);
+    configuration.insert("durationSeconds", durationSeconds);
+    configuration.insert("hubUrl", hubUrl.toString());
+
+    QJsonObject latency;
+    latency.insert("p50", percentile(updateSample, 0.5));
+    latency.insert("p99", percentile(updateSample, 0.99));
+    latency.insert("mean", updateSample.isEmpty() ? 0 : updateSum / updateSample.count());
+    latency.insert("max", updateSample.isEmpty() ? 0 : updateSample.last());
+
+    QJsonObject updates;
+    updates.insert("completed", updateSample.count());
+    updates.insert("perSecond", updateSample.count() / seconds);
+    updates.insert("latencyMs", latency);
+
+    QJsonObject hubRequests;
+    hubRequests.insert("completed", (double)requests);
+    hubRequests.insert("perSecond", requests / seconds);
+    hubRequests.insert("errors", (double)errors);
+
+    //Usage counted over the measured window only, except the peak which the system keeps for the whole run
+    double userSeconds = endUsage.userSeconds - startUsage.userSeconds;
+    double systemSeconds = endUsage.systemSeconds - startUsage.systemSeconds;
+
+    QJsonObject cpu;
+    cpu.insert("userSeconds", userSeconds);
+    cpu.insert("systemSeconds", systemSeconds);
+    cpu.insert("percentOfOneCore", (userSeconds + systemSeconds) / seconds * 100);
+
+    result.insert("benchmark", QString("fleet"));
+    result.insert("build", build);
+    result.insert("configuration", configuration);
+    result.insert("unitsLoaded", fleetControllerAddress->getUnitCount());
+    result.insert("measuredSeconds", seconds);
+    result.insert("requests", hubRequests);
+    result.insert("updates", updates);
+    result.insert("readingsPerSecond", readings / seconds);
+    result.insert("cpu", cpu);
+    result.insert("threads", endUsage.threadCount);
+    result.insert("peakResidentKilobytes", (double)endUsage.peakResidentKilobytes);
+    result.insert("metrics", MetricsRegistry::instance()->toJson());         //Everything else, counted from the start of the run
+
+    finish();
+}
+
+void FleetBenchmark::updateCompletedSlot(int unitNumber, double milliseconds)
+{
+    Q_UNUSED(unitNumber);
+
+    if(measuringFlag)
+        updateSample.append(milliseconds);
+}
@@ -0,0 +1,99 @@
+/*      Define Header File      */
+#ifndef FLEETBENCHMARK_H
+#define FLEETBENCHMARK_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QProcess>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QVector>
+#include <QUrl>
+
+#include "fleetcontroller.h"
+#include "processusage.h"
+
+/*
+ * One benchmark run: starts a HubStandIn with the requested number of pots
+ * and response latency (or uses a hub that is already running), lets a
+ * FleetController load and poll them exactly as the app would, waits out a
+ * warm up so every unit has been polled once, then measures for a fixed time.
+ *
+ * An update is one data_request from the moment the unit posts it until its
+ * reading has been stored and checked, queueing included. Requests are every
+ * hub request that completed, of any endpoint. CPU time, threads and peak RSS
+ * are this process only; the stand-in runs in its own process so its work is
+ * not counted.
+ */
+
+/*          Class Declarations          */
+class FleetBenchmark : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FleetBenchmark(QObject *parent = nullptr);
+    ~FleetBenchmark();
+
+    /*          Configuration Mutator Methods       */
+    void setUnitCount(int inputUnits);
+    void setHubLatency(int inputLatency);                       //Milliseconds the stand-in holds every answer
+    void setPollInterval(int inputSeconds);                     //Every unit is polled this often
+    void setRowInterval(int inputInterval);                     //Milliseconds between rows the stand-in generates, 0 for none
+    void setPushUpdates(bool inputPushFlag);
+    void setWarmup(int inputSeconds);
+    void setDuration(int inputSeconds);
+    void setStandInPath(QString inputPath);
+    void setHubUrl(QUrl inputUrl);                              //Benchmark against this hub instead of a stand-in
+
+    bool start();                                               //false if no hub could be started
+    QJsonObject getResult();
+
+signals:
+    void finished();
+
+public slots:
+    void unitsLoadedSlot();
+    void loadTimeoutSlot();
+    void measurementStartSlot();
+    void measurementEndSlot();
+    void updateCompletedSlot(int unitNumber, double milliseconds);
+    void unitCreatedSlot(BioBloomUnit* unit);
+
+private:
+    /*          Configuration Objects               */
+    int unitCount;
+    int hubLatency;
+    int pollInterval;
+    int rowInterval;
+    bool pushUpdatesFlag;
+    int warmupSeconds;
+    int durationSeconds;
+    QString standInPath;
+    QUrl hubUrl;
+
+    /*          Run Objects                         */
+    QProcess* standInProcess;
+    FleetController* fleetControllerAddress;
+    bool loadedFlag;
+    bool measuringFlag;
+    QElapsedTimer measurementClock;
+    QVector<double> updateSample;                              //Milliseconds, every update while measuring
+
+    ProcessUsage startUsage;
+    qint64 startRequests;
+    qint64 startErrors;
+    qint64 startReadings;
+
+    QJsonObject result;
+
+    bool launchStandIn();
+    QString findStandIn();
+    void finish(QString inputError = QString());
+
+    static qint64 completedRequests();
+    static qint64 failedRequests();
+    static double percentile(QVector<double> &sortedSamples, double fraction);
+};
+
+#endif // FLEETBENCHMARK_H
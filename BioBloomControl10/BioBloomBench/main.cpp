@@ -0,0 +1,151 @@
+#include "fleetbenchmark.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QLoggingCategory>
+#include <QTemporaryDir>
+#include <QSettings>
+#include <QProcess>
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QFile>
+#include <QDebug>
+
+static bool writeOutput(QString path, QByteArray document)
+{
+    if(path == "-")
+    {
+        QFile standardOutput;
+        standardOutput.open(stdout, QIODevice::WriteOnly);
+
+        return standardOutput.write(document + "\n") > 0;
+    }
+
+    QFile outputFile(path);
+
+    if(!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qCritical() << "Could not write" << path << outputFile.errorString();
+        return false;
+    }
+
+    outputFile.write(document);
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    a.setOrganizationName("BioBloom");
+    a.setApplicationName("BioBloomBench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Drives BioBloomCore against a HubStandIn and reports how the client copes with the fleet");
+    parser.addHelpOption();
+
+    QCommandLineOption unitsOption("units", "Pots in the fleet; a comma separated list runs each size in turn, e.g. 10,100,1000,10000.", "count", "100");
+    QCommandLineOption latencyOption("latency", "Milliseconds the stand-in holds back every answer.", "ms", "0");
+    QCommandLineOption pollOption("poll", "Seconds between polls of each unit.", "seconds", "15");
+    QCommandLineOption rowOption("row-interval", "Milliseconds between rows the stand-in generates by itself, 0 for none.", "ms", "0");
+    QCommandLineOption pushOption("push", "Keep the subscribe.php long poll open as the app does by default.");
+    QCommandLineOption warmupOption("warmup", "Seconds after loading before measuring; defaults to one poll interval.", "seconds");
+    QCommandLineOption durationOption("duration", "Seconds to measure for.", "seconds", "60");
+    QCommandLineOption outputOption("output", "File the JSON results are written to, - for standard output.", "file", "-");
+    QCommandLineOption standInOption("standin", "HubStandIn executable, found beside this one by default.", "path");
+    QCommandLineOption hubOption("hub-url", "Use this running hub instead of starting a stand-in; --units and --latency are then up to it.", "url");
+    QCommandLineOption debugOption("debug-output", "Keep the client's debug messages, which are part of its cost but off by default.");
+    parser.addOption(unitsOption);
+    parser.addOption(latencyOption);
+    parser.addOption(pollOption);
+    parser.addOption(rowOption);
+    parser.addOption(pushOption);
+    parser.addOption(warmupOption);
+    parser.addOption(durationOption);
+    parser.addOption(outputOption);
+    parser.addOption(standInOption);
+    parser.addOption(hubOption);
+    parser.addOption(debugOption);
+    parser.process(a);
+
+    QStringList unitCounts = parser.value(unitsOption).split(",", QString::SkipEmptyParts);
+
+    if(unitCounts.count() > 1)
+    {
+        //Each size runs in a fresh process so peak memory and threads belong to that size alone
+        QJsonArray runs;
+        QStringList sharedArguments;
+
+        QList<QCommandLineOption> valueOptions;
+        valueOptions << latencyOption << pollOption << rowOption << warmupOption << durationOption << standInOption << hubOption;
+
+        for(int i = 0; i < valueOptions.count(); i++)
+            if(parser.isSet(valueOptions[i]))
+                sharedArguments << "--" + valueOptions[i].names().first() << parser.value(valueOptions[i]);
+
+        if(parser.isSet(pushOption))
+            sharedArguments << "--push";
+
+        if(parser.isSet(debugOption))
+            sharedArguments << "--debug-output";
+
+        for(int i = 0; i < unitCounts.count(); i++)
+        {
+            QStringList arguments = sharedArguments;
+            arguments << "--units" << unitCounts[i].trimmed() << "--output" << "-";
+
+            qInfo() << "Running" << unitCounts[i].trimmed() << "units";
+
+            QProcess run;
+            run.setProcessChannelMode(QProcess::ForwardedErrorChannel);
+            run.start(a.applicationFilePath(), arguments);
+            run.waitForFinished(-1);
+
+            QJsonDocument runResult = QJsonDocument::fromJson(run.readAllStandardOutput());
+
+            if(runResult.isObject())
+                runs.append(runResult.object());
+            else
+                qWarning() << "Run with" << unitCounts[i] << "units gave no result";
+        }
+
+        return writeOutput(parser.value(outputOption), QJsonDocument(runs).toJson()) ? 0 : 1;
+    }
+
+    if(!parser.isSet(debugOption))
+        QLoggingCategory::setFilterRules("*.debug=false");                //Every reading is logged several times over
+
+    QTemporaryDir settingsDirectory;                                       //The user's own BioBloom settings are neither read nor changed
+    QSettings::setDefaultFormat(QSettings::IniFormat);
+    QSettings::setPath(QSettings::IniFormat, QSettings::UserScope, settingsDirectory.path());
+
+    int pollSeconds = parser.value(pollOption).toInt();
+
+    FleetBenchmark benchmark;
+    benchmark.setUnitCount(parser.value(unitsOption).toInt());
+    benchmark.setHubLatency(parser.value(latencyOption).toInt());
+    benchmark.setPollInterval(pollSeconds);
+    benchmark.setRowInterval(parser.value(rowOption).toInt());
+    benchmark.setPushUpdates(parser.isSet(pushOption));
+    benchmark.setWarmup(parser.isSet(warmupOption) ? parser.value(warmupOption).toInt() : pollSeconds);
+    benchmark.setDuration(parser.value(durationOption).toInt());
+
+    if(parser.isSet(standInOption))
+        benchmark.setStandInPath(parser.value(standInOption));
+
+    if(parser.isSet(hubOption))
+        benchmark.setHubUrl(QUrl::fromUserInput(parser.value(hubOption)));
+
+    QObject::connect(&benchmark, SIGNAL(finished()), &a, SLOT(quit()));
+
+    if(!benchmark.start())
+        return 1;
+
+    a.exec();
+
+    QJsonObject result = benchmark.getResult();
+
+    if(!writeOutput(parser.value(outputOption), QJsonDocument(result).toJson()))
+        return 1;
+
+    return result.contains("error") ? 1 : 0;
+}
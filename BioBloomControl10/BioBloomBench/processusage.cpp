@@ -0,0 +1,89 @@
+/*                  Header File                 */
+#include "processusage.h"
+#include <QFile>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#include <tlhelp32.h>
+#elif defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+#if defined(Q_OS_WIN)
+static double fileTimeSeconds(const FILETIME& time)
+{
+    ULARGE_INTEGER ticks;
+    ticks.LowPart = time.dwLowDateTime;
+    ticks.HighPart = time.dwHighDateTime;
+
+    return ticks.QuadPart / 1e7;                                                //100 ns ticks
+}
+#endif
+
+/*              Class Methods                   */
+ProcessUsage ProcessUsage::current()
+{
+    ProcessUsage usage;
+    usage.userSeconds = -1;
+    usage.systemSeconds = -1;
+    usage.peakResidentKilobytes = -1;
+    usage.threadCount = -1;
+
+#if defined(Q_OS_WIN)
+    FILETIME created, exited, kernel, user;
+
+    if(GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user))
+    {
+        usage.userSeconds = fileTimeSeconds(user);
+        usage.systemSeconds = fileTimeSeconds(kernel);
+    }
+
+    PROCESS_MEMORY_COUNTERS memory;
+
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &memory, sizeof(memory)))
+        usage.peakResidentKilobytes = memory.PeakWorkingSetSize / 1024;
+
+    HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPTHREAD, 0);
+
+    if(snapshot != INVALID_HANDLE_VALUE)
+    {
+        THREADENTRY32 thread;
+        thread.dwSize = sizeof(thread);
+        usage.threadCount = 0;
+
+        for(BOOL more = Thread32First(snapshot, &thread); more; more = Thread32Next(snapshot, &thread))
+            if(thread.th32OwnerProcessID == GetCurrentProcessId())
+                usage.threadCount++;
+
+        CloseHandle(snapshot);
+    }
+#elif defined(Q_OS_UNIX)
+    struct rusage resources;
+
+    if(getrusage(RUSAGE_SELF, &resources) == 0)
+    {
+        usage.userSeconds = resources.ru_utime.tv_sec + resources.ru_utime.tv_usec / 1e6;
+        usage.systemSeconds = resources.ru_stime.tv_sec + resources.ru_stime.tv_usec / 1e6;
+
+#if defined(Q_OS_DARWIN)
+        usage.peakResidentKilobytes = resources.ru_maxrss / 1024;                 //Bytes on macOS
+#else
+        usage.peakResidentKilobytes = resources.ru_maxrss;                        //Kilobytes on Linux
+#endif
+    }
+
+    QFile status("/proc/self/status");                                          //Linux only, the Pi included
+
+    if(status.open(QIODevice::ReadOnly))
+    {
+        QList<QByteArray> lines = status.readAll().split('\n');
+
+        for(int i = 0; i < lines.count(); i++)
+            if(lines[i].startsWith("Threads:"))
+                usage.threadCount = lines[i].mid(8).trimmed().toInt();
+    }
+#endif
+
+    return usage;
+}
@@ -0,0 +1,24 @@
+/*      Define Header File      */
+#ifndef PROCESSUSAGE_H
+#define PROCESSUSAGE_H
+
+/*      Library Classes         */
+#include <QtGlobal>
+
+/*
+ * What this process has cost so far, as the operating system counts it.
+ * Anything the platform cannot report is left at -1.
+ */
+
+/*          Class Declarations          */
+struct ProcessUsage
+{
+    double userSeconds;                                         //CPU time in our own code
+    double systemSeconds;                                       //CPU time in the kernel on our behalf
+    qint64 peakResidentKilobytes;                               //High water mark of physical memory
+    int threadCount;                                            //Threads alive right now
+
+    static ProcessUsage current();
+};
+
+#endif // PROCESSUSAGE_H
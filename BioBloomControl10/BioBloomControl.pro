@@ -25,41 +25,43 @@ DEFINES += QT_DEPRECATED_WARNINGS
 # You can also select to disable deprecated APIs only up to a certain version of Qt.
 #DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
 
+# Hub client, units, profiles and polling, shared with BioBloomHeadless.
+# Build through BioBloom.pro so the library is there first
+include(BioBloomCore/BioBloomCore.pri)
 
 SOURCES += \
         main.cpp \
         mainwindow.cpp \
-    biobloomunit.cpp \
     unitwindow.cpp \
     musicwindow.cpp \
-    unitribbon.cpp \
     settingswindow.cpp \
     dataribbon.cpp \
     chart.cpp \
     graphdisplay.cpp \
-    plantprofile.cpp \
     configurewindow.cpp \
-    unitworker.cpp \
+    unitlistmodel.cpp \
+    unitribbondelegate.cpp \
+    diagnosticswindow.cpp \
+    unitwindowcache.cpp \
 
 HEADERS += \
         mainwindow.h \
-    biobloomunit.h \
     unitwindow.h \
     musicwindow.h \
-    unitribbon.h \
     settingswindow.h \
     dataribbon.h \
     chart.h \
     graphdisplay.h \
-    plantprofile.h \
     configurewindow.h \
-    unitworker.h \
+    unitlistmodel.h \
+    unitribbondelegate.h \
+    diagnosticswindow.h \
+    unitwindowcache.h \
 
 FORMS += \
         mainwindow.ui \
     unitwindow.ui \
     musicwindow.ui \
-    unitribbon.ui \
     settingswindow.ui \
     dataribbon.ui \
     configurewindow.ui
@@ -0,0 +1,21 @@
+# Included by every project that links BioBloomCore. The library is looked
+# for where BioBloom.pro builds it: the build tree mirrors the source tree,
+# so it sits as far from the including project's build directory as this
+# file is from its .pro
+
+QT       += core
+QT       += network
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+BIOBLOOMCORE_OUT = $$clean_path($$OUT_PWD/$$relative_path($$PWD, $$_PRO_FILE_PWD_))
+
+win32:CONFIG(release, debug|release): BIOBLOOMCORE_OUT = $$BIOBLOOMCORE_OUT/release
+else:win32:CONFIG(debug, debug|release): BIOBLOOMCORE_OUT = $$BIOBLOOMCORE_OUT/debug
+
+LIBS += -L$$BIOBLOOMCORE_OUT -lBioBloomCore
+
+win32-g++: PRE_TARGETDEPS += $$BIOBLOOMCORE_OUT/libBioBloomCore.a
+else:win32: PRE_TARGETDEPS += $$BIOBLOOMCORE_OUT/BioBloomCore.lib
+else: PRE_TARGETDEPS += $$BIOBLOOMCORE_OUT/libBioBloomCore.a
@@ -0,0 +1,54 @@
+#-------------------------------------------------
+#
+# Everything BioBloomControl does without a window: talking to the hub,
+# parsing, unit state, plant profiles, polling and the pot control checks.
+# Built as a static library for the app, the headless supervisor and
+# anything else that wants to drive a fleet. Link it with BioBloomCore.pri
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += network
+QT       -= gui
+
+TARGET = BioBloomCore
+TEMPLATE = lib
+CONFIG += staticlib
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+    biobloomunit.cpp \
+    plantprofile.cpp \
+    plantprofilecatalog.cpp \
+    unitworker.cpp \
+    hubclient.cpp \
+    pollscheduler.cpp \
+    subscriptionchannel.cpp \
+    sensorrecords.cpp \
+    hubfieldreader.cpp \
+    unithistory.cpp \
+    sensorrollup.cpp \
+    commanddebouncer.cpp \
+    fairrequestqueue.cpp \
+    metricsregistry.cpp \
+    tracerecorder.cpp \
+    fleetcontroller.cpp \
+
+HEADERS += \
+    biobloomunit.h \
+    plantprofile.h \
+    plantprofilecatalog.h \
+    unitworker.h \
+    hubclient.h \
+    pollscheduler.h \
+    subscriptionchannel.h \
+    sensorrecords.h \
+    hubfieldreader.h \
+    unithistory.h \
+    sensorrollup.h \
+    commanddebouncer.h \
+    fairrequestqueue.h \
+    metricsregistry.h \
+    tracerecorder.h \
+    fleetcontroller.h \
@@ -0,0 +1,358 @@
+/*                  Header File                 */
+#include "biobloomunit.h"
+#include "metricsregistry.h"
+
+/*          Constructor and Destructor          */
+BioBloomUnit::BioBloomUnit(QObject *parent) : QObject(parent)
+{
+    historyAddress = new UnitHistory(this);
+    unitNumber = -1;                                                              //Until the fleet numbers it
+    unitPlantProfile = PlantProfileCatalog::instance()->defaultProfile();
+
+    disablePumpFlag = 0;
+    readingReceivedFlag = 0;
+    dataRequestPendingFlag = 0;
+    lastDataNumber = 0;
+}
+
+BioBloomUnit::~BioBloomUnit()
+{
+}
+
+
+
+/*               Class Slots                    */
+void BioBloomUnit::potDataRequestSlot()
+{
+    if(dataRequestPendingFlag)                                                    //A refresh is already on its way
+        return;
+
+    dataRequestPendingFlag = 1;
+
+    HubReply* reply = HubClient::instance()->dataRequest(this->getMacAddress());  //Hub pokes the pot and replies once the new row has landed
+    dataRequestReplyAddress = reply;
+    dataRequestClock.start();
+
+    connect(reply,
+            SIGNAL(finished(HubReply*)),
+            this,
+            SLOT(dataRequestFinished(HubReply*)));
+}
+
+void BioBloomUnit::refreshButtonPressSlot()
+{
+    potDataRequestSlot();                                                         //Nothing new if a poll is already pending
+
+    if(dataRequestReplyAddress)
+        dataRequestReplyAddress->setPriority(HubClient::InteractiveRead);
+}
+
+void BioBloomUnit::dataRequestFinished(HubReply* reply)
+{
+    dataRequestPendingFlag = 0;
+
+    if(reply->isError() || !readSensorReply(reply))
+    {
+        dataRequestProcessSlot();                                                 //Pot did not answer in time, show whatever the hub has
+        return;
+    }
+
+    double milliseconds = dataRequestClock.nsecsElapsed() / 1e6;                 //Queueing, the hub, parsing and the checks
+
+    MetricsRegistry::instance()->record("units.updateMs", milliseconds);
+    emit updateCompleted(unitNumber, milliseconds);
+}
+
+void BioBloomUnit::dataRequestProcessSlot()
+{
+    HubReply* reply = HubClient::instance()->recentEntry(this->getMacAddress());
+
+    connect(reply,
+            SIGNAL(finished(HubReply*)),
+            this,
+            SLOT(recentEntryFinished(HubReply*)));
+}
+
+void BioBloomUnit::recentEntryFinished(HubReply* reply)
+{   
+    if(reply->isError())
+        return;
+
+    readSensorReply(reply);
+}
+
+bool BioBloomUnit::readSensorReply(HubReply* reply)
+{
+   SensorRecords records;
+
+   if(!reply->readRecords(records) || records.count() < 1)       //No reading stored for this unit yet
+       return false;
+
+   int newest = records.count() - 1;
+
+   receiveSensorRow(reply->getLastDataNumber(),                   //recent_entry and data_request number their row in a header
+                    records.value(newest, SensorRecords::LightLevel),
+                    records.value(newest, SensorRecords::AirHumidity),
+                    records.value(newest, SensorRecords::SoilMoisture),
+                    records.value(newest, SensorRecords::Temperature),
+                    records.value(newest, SensorRecords::WaterLevel),
+                    records.value(newest, SensorRecords::BatteryLevel));
+
+   return true;
+}
+
+bool BioBloomUnit::receiveSensorRow(int inputDataNumber, double light_level, double air_humidity, double soil_moisture,
+                                    double temperature, double water_level, double battery_level)
+{
+   if(inputDataNumber >= 0 && inputDataNumber <= lastDataNumber)  //Snapshot of a quiet pot, or the recent_entry fallback
+       return false;
+
+   //Current values and the battery, water and moisture checks; an unnumbered row cannot be told
+   //from one already held, so it always gets here and the checks run again for it
+   receiveSensorReading(light_level, air_humidity, soil_moisture, temperature, water_level, battery_level);
+
+   if(inputDataNumber < 0)                                         //Hub did not number it, the next history refresh fetches it instead
+       return true;
+
+   lastDataNumber = inputDataNumber;
+
+   historyAddress->appendReading(light_level, air_humidity, soil_moisture,      //Open graphs pick up the new row without a fetch
+                                 temperature, water_level, battery_level);
+
+   emit newRowReceived(unitNumber);
+
+   return true;
+}
+
+void BioBloomUnit::receiveSensorReading(double light_level, double air_humidity, double soil_moisture,
+                                        double temperature, double water_level, double battery_level)
+{
+   receivedCurrentLight = (light_level/10);
+   receivedCurrentHumidity = (air_humidity/10);
+   receivedCurrentMoisture = (soil_moisture/10);
+   receivedCurrentTemp = (temperature/10);
+   waterLevel = (water_level/10);
+   batteryLevel = (battery_level/10);
+   
+   this->changeCurrentTemp(receivedCurrentTemp);
+   this->changeCurrentLight(receivedCurrentLight);
+   this->changeCurrentMoisture(receivedCurrentMoisture);
+   this->changeCurrentHumidity(receivedCurrentHumidity);
+
+   readingReceivedFlag = 1;
+
+   MetricsRegistry::instance()->markUnitSeen(macAddress);
+   MetricsRegistry::instance()->increment("units.readings");
+   
+   batteryCheck();
+
+   waterLevelCheck();
+   
+   moistureCheck();
+   
+   //QString nextTemp.setNum(receivedCurrentTemp);
+   //QString nextLight.setNum(receivedCurrentTemp);
+   //QString nextTemp.setNum(receivedCurrentTemp);
+   //QString nextTemp.setNum(receivedCurrentTemp);
+   
+   //this->windowAddress->tempRibbonAddress->ui->dataNumber->setText()
+
+   emit sensorReadingReceived(unitNumber);
+}
+/*         Class Accessors and Mutators         */
+int BioBloomUnit::getUnitNumber()                           //Identity Variable Accessors
+{
+    return unitNumber;
+}
+
+QString BioBloomUnit::getMacAddress()
+{
+    return macAddress;
+}
+
+QString BioBloomUnit::getPlantName()
+{
+    return plantName;
+}
+
+QString BioBloomUnit::getPlantType()
+{
+    return plantType;
+}
+
+int BioBloomUnit::getLastDataNumber()
+{
+    return lastDataNumber;
+}
+
+int BioBloomUnit::getIdealTemp()                          //Reference Variable Accessors
+{
+    return idealTemp;
+}
+
+int BioBloomUnit::getIdealMoisture()
+{
+    return idealMoisture;
+}
+
+int BioBloomUnit::getIdealHumidity()
+{
+    return idealHumidity;
+}
+
+double BioBloomUnit::getCurrentTemp()                         //Data Variable Accessors
+{
+    return currentTemp;
+}
+
+double BioBloomUnit::getCurrentLight()
+{
+    return currentLight;
+}
+
+double BioBloomUnit::getCurrentMoisture()
+{
+    return currentMoisture;
+}
+
+double BioBloomUnit::getCurrentHumidity()
+{
+    return currentHumidity;
+}
+
+void BioBloomUnit::setUnitNumber(int inputUnitNumber)         //Identity Variable Mutators
+{
+    unitNumber = inputUnitNumber;
+}
+
+void BioBloomUnit::setMacAddress(QString inputMacAddress)
+{
+    macAddress = inputMacAddress;
+    historyAddress->setMacAddress(inputMacAddress);
+}
+
+void BioBloomUnit::setPlantName(QString inputPlantName)
+{
+    plantName = inputPlantName;
+
+    emit unitChanged(unitNumber);
+}
+
+void BioBloomUnit::setPlantType(QString inputPlantType)
+{
+    plantType = inputPlantType;
+}
+
+void BioBloomUnit::setIdealTemp(int inputTemp)                //Reference Variable Mutators
+{
+    idealTemp = inputTemp;
+}
+
+void BioBloomUnit::setIdealMoisture(int inputMoisture)
+{
+    idealMoisture = inputMoisture;
+}
+
+void BioBloomUnit::setIdealHumidity(int inputHumidity)
+{
+    idealHumidity = inputHumidity;
+}
+
+void BioBloomUnit::changeCurrentTemp(double inputTemp)           //Data Variable Mutators
+{
+    currentTemp = inputTemp;
+}
+
+void BioBloomUnit::changeCurrentLight(double inputLight)
+{
+    currentLight = inputLight;
+}
+
+void BioBloomUnit::changeCurrentMoisture(double inputMoisture)
+{
+    currentMoisture = inputMoisture;
+}
+
+void BioBloomUnit::changeCurrentHumidity(double inputHumidity)
+{
+    currentHumidity = inputHumidity;
+}
+
+
+
+/*              Class Methods               */
+void BioBloomUnit::setPlantProfileTemplate(PlantProfilePointer inputPlantProfile)
+{
+    unitPlantProfile = inputPlantProfile;
+
+    emit unitChanged(unitNumber);
+}
+
+void BioBloomUnit::batteryCheck()
+{
+
+    if(batteryLevel > 20)
+    {
+        batteryLevelLowFlag = 0;
+        batteryWarningGivenFlag = 0;
+    }
+
+
+    if(batteryLevel <= 20)
+    {
+        batteryLevelLowFlag = 1;
+
+        if(batteryWarningGivenFlag = 0)
+            //shout warning
+
+        batteryWarningGivenFlag = 1;
+    }
+
+}
+
+void BioBloomUnit::waterLevelCheck()
+{
+
+    if(waterLevel > 20)
+    {
+        waterLevelLowFlag = 0;
+        waterWarningGivenFlag = 0;
+        disablePumpFlag = 0;
+    }
+
+
+    if(waterLevel <= 20)
+    {
+        waterLevelLowFlag = 1;
+
+        if(waterWarningGivenFlag = 0)
+            //shout warning
+
+        waterWarningGivenFlag = 1;
+    }
+
+
+    if(waterLevel <= 10)
+    {
+        waterLevelEmptyFlag = 1;
+
+        disablePumpFlag = 1;
+    }
+
+}
+
+void BioBloomUnit::moistureCheck()
+{
+    if(!(disablePumpFlag))
+        if(receivedCurrentMoisture < unitPlantProfile->idealMoisture)
+            emit waterPlant();
+}
+
+void BioBloomUnit::waterPlantSlot()
+{
+    QString actionID = "water";
+    
+    HubClient::instance()->actionRequest(this->getMacAddress(), actionID);
+
+    emit plantWatered();
+}
@@ -0,0 +1,146 @@
+/*      Define Header File      */
+#ifndef BIOBLOOMUNIT_H
+#define BIOBLOOMUNIT_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QUrl>
+#include <QUrlQuery>
+#include <QPointer>
+#include <QElapsedTimer>
+
+#include "plantprofile.h"
+#include "plantprofilecatalog.h"
+#include "hubclient.h"
+#include "unithistory.h"
+
+/*
+ * One pot: its identity, profile, latest reading and the checks run on every
+ * reading. Nothing here touches a widget, the app keeps the pot's windows in
+ * a UnitWindowCache and the headless supervisor has none at all.
+ */
+
+/*          Class Declarations          */
+class PlantProfile;
+class BioBloomUnit : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit BioBloomUnit(QObject *parent = nullptr);           //Constructor
+    ~BioBloomUnit();
+
+    UnitHistory* historyAddress;                               //Sensor history shared by all of the unit's graphs
+
+    void setPlantProfileTemplate(PlantProfilePointer inputPlantProfile);
+    PlantProfilePointer unitPlantProfile;                      //Shared with the catalog, never copied
+    
+    double batteryLevel;
+    double waterLevel;
+    
+    bool batteryLevelLowFlag;
+    bool batteryWarningGivenFlag;
+
+    bool waterLevelLowFlag;
+    bool waterLevelEmptyFlag;
+    bool waterWarningGivenFlag;
+
+    bool disablePumpFlag;
+    bool readingReceivedFlag;                                   //Set once the first sensor reading has arrived
+    
+    
+    double receivedCurrentTemp;
+    double receivedCurrentLight;
+    double receivedCurrentMoisture;
+    double receivedCurrentHumidity;
+
+    /*          Identity Accessor Methods           */
+    int getUnitNumber();
+    QString getMacAddress();
+    QString getPlantName();
+    QString getPlantType();
+
+    /*          Reference Accessor Methods          */
+    int getIdealTemp();
+    int getIdealMoisture();
+    int getIdealHumidity();
+
+    /*          Data Accessor Methods               */
+    double getCurrentTemp();
+    double getCurrentLight();
+    double getCurrentMoisture();
+    double getCurrentHumidity();
+
+    /*          Identity Mutator Methods            */
+    void setUnitNumber(int inputUnitNumber);
+    void setMacAddress(QString inputMacAddress);
+    void setPlantName(QString inputPlantName);
+    void setPlantType(QString inputPlantType);
+
+    /*          Reference Mutator Methods           */
+    void setIdealTemp(int inputTemp);
+    void setIdealMoisture(int inputMoisture);
+    void setIdealHumidity(int inputHumidity);
+
+    /*          Data Mutator Methods                */
+    void changeCurrentTemp(double inputTemp);
+    void changeCurrentLight(double inputLight);
+    void changeCurrentMoisture(double inputMoisture);
+    void changeCurrentHumidity(double inputHumidity);
+
+    /*          Sensor Reading Method               */
+    bool receiveSensorRow(int inputDataNumber, double light_level, double air_humidity, double soil_moisture,
+                          double temperature, double water_level, double battery_level);          //Raw hub values, in tenths, false for a row already held; -1 is never treated as held
+    int getLastDataNumber();                                    //Newest row stored, 0 before the first
+    
+signals:
+    void waterPlant();
+    void sensorReadingReceived(int unitNumber);                 //Emitted whenever new values have been stored
+    void newRowReceived(int unitNumber);                        //Emitted once per data_number, after the row is in the history
+    void unitChanged(int unitNumber);                           //Name or profile changed
+    void plantWatered();                                        //Emitted after a water command has been sent
+    void updateCompleted(int unitNumber, double milliseconds);  //A data request's reading has been stored, timed from the request
+  
+public slots:
+    void potDataRequestSlot();
+    void refreshButtonPressSlot();                              //Same request, ahead of the background polling
+    void dataRequestFinished(HubReply* reply);
+    void dataRequestProcessSlot();
+    void recentEntryFinished(HubReply* reply);
+    void waterPlantSlot();
+    
+
+private:
+    /*              Identity Objects                */
+    int unitNumber;
+    QString macAddress;
+    QString plantName;
+    QString plantType;
+
+    /*              Reference Objects               */
+    int idealTemp;
+    int idealMoisture;
+    int idealHumidity;
+
+    /*              Data Objects                    */
+    double currentTemp;
+    double currentLight;
+    double currentMoisture;
+    double currentHumidity;
+
+    bool dataRequestPendingFlag;
+    QPointer<HubReply> dataRequestReplyAddress;                 //Cleared once the reply has finished
+    QElapsedTimer dataRequestClock;                             //Started as the data request is posted
+    int lastDataNumber;                                         //Rows at or below this are repeats and are not stored again
+    
+    /*              Class Methods                   */
+    bool readSensorReply(HubReply* reply);
+    void receiveSensorReading(double light_level, double air_humidity, double soil_moisture,
+                              double temperature, double water_level, double battery_level);
+    void batteryCheck();
+    void waterLevelCheck();    
+    void moistureCheck();
+    
+};
+
+#endif // BIOBLOOMUNIT_H
@@ -0,0 +1,89 @@
+/*                  Header File                 */
+#include "commanddebouncer.h"
+
+/*          Constructor and Destructor          */
+CommandDebouncer::CommandDebouncer(Command inputCommand, QString inputMacAddress, QObject *parent) : QObject(parent),
+                                                                                                     command(inputCommand),
+                                                                                                     macAddress(inputMacAddress),
+                                                                                                     pendingFlag(false)
+{
+    quietTimer = new QTimer(this);
+    quietTimer->setSingleShot(true);
+    quietTimer->setInterval(300);
+
+    connect(quietTimer, SIGNAL(timeout()), this, SLOT(quietTimeoutSlot()));
+}
+
+CommandDebouncer::~CommandDebouncer()
+{
+    inFlightReply = nullptr;                                                      //Nothing will be left to wait for it
+    flush();                                                                      //The last press of a gesture still reaches the pot
+}
+
+
+
+/*              Class Methods                   */
+void CommandDebouncer::submit(QStringList inputValues)
+{
+    pendingValues = inputValues;
+    pendingFlag = true;
+
+    quietTimer->start();                                                          //Every press pushes the send back
+}
+
+void CommandDebouncer::flush()
+{
+    quietTimer->stop();
+
+    if(pendingFlag)
+        send();
+}
+
+void CommandDebouncer::send()
+{
+    if(inFlightReply && inFlightReply->getState() == HubReply::InFlight)
+        return;                                                                   //The pot may already be acting on it, commandFinished() sends the newest value
+
+    pendingFlag = false;
+
+    if(inFlightReply && (inFlightReply->getState() == HubReply::Queued || inFlightReply->getState() == HubReply::RetryWaiting))
+        inFlightReply->abort();                                                   //Never reached the pot, the new value takes its place
+
+    HubReply* reply;
+
+    if(command == Volume)
+        reply = HubClient::instance()->volumeRequest(macAddress, pendingValues.value(0));
+    else
+        reply = HubClient::instance()->rgbRequest(macAddress, pendingValues.value(0), pendingValues.value(1), pendingValues.value(2));
+
+    inFlightReply = reply;
+    connect(reply, SIGNAL(finished(HubReply*)), this, SLOT(commandFinished(HubReply*)));
+}
+
+int CommandDebouncer::getQuietInterval()
+{
+    return quietTimer->interval();
+}
+
+void CommandDebouncer::setQuietInterval(int inputInterval)
+{
+    quietTimer->setInterval(qMax(0, inputInterval));
+}
+
+
+
+/*               Class Slots                    */
+void CommandDebouncer::quietTimeoutSlot()
+{
+    if(pendingFlag)
+        send();
+}
+
+void CommandDebouncer::commandFinished(HubReply* reply)
+{
+    if(inFlightReply == reply)
+        inFlightReply = nullptr;
+
+    if(pendingFlag && !quietTimer->isActive())                                    //Held back while this one was on the wire
+        send();
+}
@@ -0,0 +1,60 @@
+/*      Define Header File      */
+#ifndef COMMANDDEBOUNCER_H
+#define COMMANDDEBOUNCER_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QTimer>
+#include <QPointer>
+#include <QStringList>
+
+#include "hubclient.h"
+
+/*
+ * Collapses a burst of presses on one pot control into a single command. Each
+ * submit() replaces the pending values and restarts a short quiet window; only
+ * when the window runs out is the newest value sent. If the previous command for
+ * this control is still waiting to go out it is aborted, since the pot is about to
+ * be told something newer; once it is on the wire it is left to finish and the
+ * newest value follows from commandFinished(). A value still pending when the
+ * debouncer is destroyed is sent straight away rather than dropped.
+ */
+
+/*          Class Declarations          */
+class CommandDebouncer : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Command
+    {
+        Volume,                                                 //values: volume
+        Rgb                                                     //values: r, g, b
+    };
+
+    explicit CommandDebouncer(Command inputCommand, QString inputMacAddress, QObject *parent = nullptr);
+    ~CommandDebouncer();
+
+    void submit(QStringList inputValues);                       //Newest values win, sent once the presses stop
+    void flush();                                               //Send anything pending now
+
+    int getQuietInterval();
+    void setQuietInterval(int inputInterval);                   //Milliseconds without a press before sending
+
+public slots:
+    void quietTimeoutSlot();
+    void commandFinished(HubReply* reply);
+
+private:
+    Command command;
+    QString macAddress;
+
+    QTimer* quietTimer;
+    QStringList pendingValues;
+    bool pendingFlag;
+    QPointer<HubReply> inFlightReply;                          //Cleared when the reply finishes and deletes itself
+
+    void send();
+};
+
+#endif // COMMANDDEBOUNCER_H
@@ -0,0 +1,78 @@
+/*                  Header File                 */
+#include "fairrequestqueue.h"
+
+/*               Class Constructor              */
+FairRequestQueue::FairRequestQueue() : replyCount(0)
+{
+}
+
+
+
+/*              Class Methods                   */
+void FairRequestQueue::append(const QString& unitKey, HubReply* reply)
+{
+    QList<HubReply*>& replies = unitReplies[unitKey];
+
+    if(replies.isEmpty())
+        unitTurn.append(unitKey);                                                  //Joins the back of the rotation
+
+    replies.append(reply);
+    replyCount++;
+}
+
+bool FairRequestQueue::remove(const QString& unitKey, HubReply* reply)
+{
+    QHash<QString, QList<HubReply*> >::iterator unit = unitReplies.find(unitKey);
+
+    if(unit == unitReplies.end() || !unit->removeOne(reply))
+        return false;
+
+    replyCount--;
+
+    if(unit->isEmpty())
+    {
+        unitReplies.erase(unit);
+        unitTurn.removeOne(unitKey);
+    }
+
+    return true;
+}
+
+HubReply* FairRequestQueue::takeNext(const QHash<QString, int>& busyUnits, int unitLimit)
+{
+    int turns = unitTurn.count();
+
+    for(int i = 0; i < turns; i++)
+    {
+        QString unitKey = unitTurn.takeFirst();
+
+        if(!unitKey.isEmpty() && busyUnits.value(unitKey) >= unitLimit)
+        {
+            unitTurn.append(unitKey);                                              //Pot is busy, it is tried again on a later turn
+            continue;
+        }
+
+        QList<HubReply*>& replies = unitReplies[unitKey];
+        HubReply* reply = replies.takeFirst();
+        replyCount--;
+
+        if(replies.isEmpty())
+            unitReplies.remove(unitKey);
+        else
+            unitTurn.append(unitKey);                                              //Back of the line for its next request
+
+        return reply;
+    }
+
+    return nullptr;
+}
+
+int FairRequestQueue::count() const
+{
+    return replyCount;
+}
+
+bool FairRequestQueue::isEmpty() const
+{
+    return replyCount == 0;
+}
@@ -0,0 +1,40 @@
+/*      Define Header File      */
+#ifndef FAIRREQUESTQUEUE_H
+#define FAIRREQUESTQUEUE_H
+
+/*      Library Classes         */
+#include <QString>
+#include <QList>
+#include <QHash>
+
+/*
+ * Waiting hub requests of one priority class. Requests are kept in a queue per
+ * pot and the pots take turns, so one pot with a long backlog cannot hold up a
+ * pot with a single request. Requests that name no pot share a queue of their
+ * own that takes its turn like any other.
+ */
+
+/*          Class Declarations          */
+class HubReply;
+class FairRequestQueue
+{
+
+public:
+    FairRequestQueue();
+
+    void append(const QString& unitKey, HubReply* reply);
+    bool remove(const QString& unitKey, HubReply* reply);
+
+    //Next request in turn whose pot has fewer than unitLimit requests in busyUnits, NULL if none can go
+    HubReply* takeNext(const QHash<QString, int>& busyUnits, int unitLimit);
+
+    int count() const;
+    bool isEmpty() const;
+
+private:
+    QHash<QString, QList<HubReply*> > unitReplies;              //Pot MAC -> its waiting requests, oldest first
+    QList<QString> unitTurn;                                    //Pots with something waiting, next turn first
+    int replyCount;
+};
+
+#endif // FAIRREQUESTQUEUE_H
@@ -0,0 +1,222 @@
+/*                  Header File                 */
+#include "fleetcontroller.h"
+#include "hubfieldreader.h"
+#include "metricsregistry.h"
+#include "tracerecorder.h"
+#include <QSettings>
+#include <QElapsedTimer>
+#include <QDebug>
+
+/*          Constructor and Destructor          */
+FleetController::FleetController(QObject *parent) : QObject(parent)
+{
+    QSettings settings;
+    pollScheduler = new PollScheduler(this);
+    pollScheduler->setIntervalBounds(settings.value("polling/minimumIntervalSeconds", 15).toInt() * 1000,            //Busy units are polled this often
+                                     settings.value("polling/maximumIntervalSeconds", 600).toInt() * 1000);         //Flat units back off to this
+
+    fleetSnapshotTimer = new QTimer(this);
+    fleetSnapshotTimer->setInterval(60000);
+    connect(fleetSnapshotTimer, SIGNAL(timeout()), this, SLOT(fleetSnapshotRequestSlot()));
+
+    subscriptionChannel = NULL;
+
+    if(settings.value("hub/pushUpdates", true).toBool())
+    {
+        subscriptionChannel = new SubscriptionChannel(this);
+        connect(subscriptionChannel, SIGNAL(channelUp()), this, SLOT(subscriptionUpSlot()));
+        connect(subscriptionChannel, SIGNAL(channelDown()), this, SLOT(subscriptionDownSlot()));
+    }
+}
+
+FleetController::~FleetController()
+{
+    stop();
+}
+
+
+
+/*              Class Methods                   */
+void FleetController::start()
+{
+    pollScheduler->start();
+
+    if(subscriptionChannel)
+        subscriptionChannel->start();
+
+    HubReply* reply = HubClient::instance()->ribbonBoot();
+    connect(reply, SIGNAL(finished(HubReply*)),
+            this, SLOT(ribbonBootFinished(HubReply*)));
+}
+
+void FleetController::stop()
+{
+    pollScheduler->stop();
+    fleetSnapshotTimer->stop();
+
+    if(subscriptionChannel)
+        subscriptionChannel->stop();
+}
+
+BioBloomUnit* FleetController::createUnit(QString mac, QString plantName, PlantProfilePointer plantProfile)
+{
+    BioBloomUnit* newUnit = new BioBloomUnit(this);                                                   //Instance a new unit class
+
+    newUnit->setUnitNumber(unitAddress.count());
+    newUnit->setMacAddress(mac);
+    newUnit->setPlantName(plantName);
+    newUnit->setPlantProfileTemplate(plantProfile);
+
+    unitAddress.append(newUnit);
+    unitByMac.insert(mac, newUnit);
+
+    UnitWorker* newWorker = new UnitWorker(newUnit, newUnit);                                         //Instance a new worker for the unit, owned by the unit
+
+    connect(newUnit, SIGNAL(sensorReadingReceived(int)), this, SIGNAL(unitReadingReceived(int)));
+    connect(newWorker, SIGNAL(dataRequestSignal()), newUnit, SLOT(potDataRequestSlot()));
+
+    pollScheduler->addWorker(newWorker);                                                             //One scheduler polls every unit from the main event loop
+
+    if(subscriptionChannel)
+        subscriptionChannel->subscribeUnit(newUnit);                                                 //New rows for this pot are pushed as soon as the hub stores them
+
+    MetricsRegistry::instance()->setGauge("units.count", unitAddress.count());
+
+    emit unitCreated(newUnit);
+
+    return newUnit;
+}
+
+void FleetController::startFleetSnapshots()
+{
+    if(!fleetSnapshotTimer->isActive() && !(subscriptionChannel && subscriptionChannel->isConnected()))
+    {
+        fleetSnapshotTimer->start();
+        fleetSnapshotRequestSlot();                                                                    //Fill the units straight away rather than after the first minute
+    }
+}
+
+
+
+/*          Fleet Accessor Methods              */
+BioBloomUnit* FleetController::unitAt(int unitNumber)
+{
+    if(unitNumber < 0 || unitNumber >= unitAddress.count())
+        return NULL;
+
+    return unitAddress[unitNumber];
+}
+
+BioBloomUnit* FleetController::unitByMacAddress(QString mac)
+{
+    return unitByMac.value(mac);
+}
+
+int FleetController::getUnitCount()
+{
+    return unitAddress.count();
+}
+
+PollScheduler* FleetController::getPollScheduler()
+{
+    return pollScheduler;
+}
+
+SubscriptionChannel* FleetController::getSubscriptionChannel()
+{
+    return subscriptionChannel;
+}
+
+
+
+/*              Class Slots                     */
+void FleetController::ribbonBootFinished(HubReply* reply)
+{
+    if(reply->isError())
+    {
+        qWarning() << "ribbon_boot failed:" << reply->errorString();
+        return;
+    }
+
+    HubFieldReader fields(reply->data());
+    QLatin1String field[3];
+
+    //mac, profile, name per unit
+    while(fields.next(field[0]) && fields.next(field[1]) && fields.next(field[2]))
+    {
+        QString mac = field[0];
+
+        if(unitByMac.contains(mac))                                                                    //Already loaded, or added while the reply was on its way
+            continue;
+
+        createUnit(mac,
+                   QString::fromUtf8(field[2].data(), field[2].size()),                                //Plant names may be UTF-8
+                   PlantProfileCatalog::instance()->profile(field[1]));                                //Unknown species get the Default profile
+    }
+
+    emit unitsLoaded();
+
+    startFleetSnapshots();
+}
+
+void FleetController::fleetSnapshotRequestSlot()
+{
+    HubReply* reply = HubClient::instance()->fleetSnapshot();
+    connect(reply, SIGNAL(finished(HubReply*)),
+            this, SLOT(fleetSnapshotFinished(HubReply*)));
+}
+
+void FleetController::fleetSnapshotFinished(HubReply* reply)
+{
+    if(reply->isError())
+        return;
+
+    TraceSpan span("fleet snapshot", "parse");
+
+    QElapsedTimer parseClock;
+    parseClock.start();
+
+    HubFieldReader fields(reply->data());
+    QLatin1String mac;
+    QLatin1String value[7];
+
+    //mac, data_number, light, humidity, moisture, temperature, water level, battery level per unit
+    while(fields.next(mac))
+    {
+        int filled = 0;
+        while(filled < 7 && fields.next(value[filled]))
+            filled++;
+
+        if(filled < 7)
+            break;
+
+        BioBloomUnit* unit = unitByMac.value(mac);
+
+        if(!unit)                                                                                      //Hub knows a pot this client has not loaded yet
+            continue;
+
+        unit->receiveSensorRow((int)HubFieldReader::toNumber(value[0]),                              //Ignored unless newer than the unit already holds
+                               HubFieldReader::toNumber(value[1]),
+                               HubFieldReader::toNumber(value[2]),
+                               HubFieldReader::toNumber(value[3]),
+                               HubFieldReader::toNumber(value[4]),
+                               HubFieldReader::toNumber(value[5]),
+                               HubFieldReader::toNumber(value[6]));
+    }
+
+    MetricsRegistry::instance()->record("hub.fleet_snapshot.parseMs", parseClock.nsecsElapsed() / 1e6);      //Includes storing each reading
+}
+
+void FleetController::subscriptionUpSlot()
+{
+    fleetSnapshotTimer->stop();                                                                        //Pushed rows keep the units current, no need to sweep the fleet
+}
+
+void FleetController::subscriptionDownSlot()
+{
+    if(!unitAddress.isEmpty() && !fleetSnapshotTimer->isActive())
+    {
+        fleetSnapshotTimer->start();                                                                   //Fall back to the periodic snapshot until the channel returns
+        fleetSnapshotRequestSlot();
+    }
+}
@@ -0,0 +1,72 @@
+/*      Define Header File      */
+#ifndef FLEETCONTROLLER_H
+#define FLEETCONTROLLER_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QTimer>
+#include <QHash>
+#include <QVector>
+#include <QString>
+
+#include "biobloomunit.h"
+#include "unitworker.h"
+#include "pollscheduler.h"
+#include "subscriptionchannel.h"
+#include "plantprofilecatalog.h"
+#include "hubclient.h"
+
+/*
+ * Runs the fleet without any windows: loads the owned pots from ribbon_boot,
+ * gives each one a UnitWorker on the shared PollScheduler, keeps the readings
+ * coming through the subscription channel, and falls back to a fleet snapshot
+ * every minute while the channel is down. MainWindow shows what it holds; the
+ * headless supervisor runs nothing else. Units are numbered in the order they
+ * are created and owned by the controller.
+ */
+
+/*          Class Declarations          */
+class FleetController : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit FleetController(QObject *parent = nullptr);
+    ~FleetController();
+
+    void start();                                               //Loads the owned pots and starts polling them
+    void stop();
+
+    BioBloomUnit* createUnit(QString mac, QString plantName, PlantProfilePointer plantProfile);      //Unit, worker and subscription in one place
+
+    /*          Fleet Accessor Methods              */
+    BioBloomUnit* unitAt(int unitNumber);
+    BioBloomUnit* unitByMacAddress(QString mac);               //NULL for pots this client has not loaded
+    int getUnitCount();
+    PollScheduler* getPollScheduler();
+    SubscriptionChannel* getSubscriptionChannel();              //NULL when hub/pushUpdates is off
+
+signals:
+    void unitCreated(BioBloomUnit* unit);
+    void unitsLoaded();                                         //Every pot ribbon_boot listed has a unit
+    void unitReadingReceived(int unitNumber);
+
+public slots:
+    void ribbonBootFinished(HubReply* reply);
+    void fleetSnapshotRequestSlot();
+    void fleetSnapshotFinished(HubReply* reply);
+    void subscriptionUpSlot();
+    void subscriptionDownSlot();
+
+private:
+    QVector<BioBloomUnit*> unitAddress;                        //Index is the unit number
+    QHash<QString, BioBloomUnit*> unitByMac;                   //Looked up when a fleet snapshot arrives
+
+    PollScheduler* pollScheduler;                              //Single timer that staggers every unit's data requests
+    QTimer* fleetSnapshotTimer;                                //Fetches every unit's newest reading in one request
+    SubscriptionChannel* subscriptionChannel;                  //Long poll the hub answers as soon as new rows land, NULL when disabled
+
+    void startFleetSnapshots();
+};
+
+#endif // FLEETCONTROLLER_H
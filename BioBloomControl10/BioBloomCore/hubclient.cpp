@@ -0,0 +1,842 @@
+/*                  Header File                 */
+#include "hubclient.h"
+#include <QCoreApplication>
+#include <QSettings>
+#include <QDebug>
+
+Q_LOGGING_CATEGORY(hubLog, "biobloom.hub", QtWarningMsg)                           //QT_LOGGING_RULES="biobloom.hub.debug=true" to see failed requests
+
+/*              Endpoint Scripts                */
+static const char* const binaryRecordsType = "application/x-biobloom-records";     //Packed sensor rows, see sensor_records.php
+
+static const char* const endpointScript[HubClient::EndpointCount] =
+{
+    "ribbon_boot.php",
+    "return_macs.php",
+    "recent_entry.php",
+    "graph_data.php",
+    "data_request.php",
+    "action_request.php",
+    "audio_request.php",
+    "volume_request.php",
+    "rgb_request.php",
+    "personalise_plant.php",
+    "fleet_snapshot.php",
+    "subscribe.php"
+};
+
+/*              Endpoint Timeouts               */
+static const int endpointTimeout[HubClient::EndpointCount] =            //Milliseconds on the wire before giving up
+{
+    10000,                          //ribbon_boot
+    10000,                          //return_macs
+    5000,                           //recent_entry
+    30000,                          //graph_data, can be the whole history
+    12000,                          //data_request, hub waits up to 8 s on the pot
+    10000,                          //action_request, forwarded to the pot
+    10000,                          //audio_request
+    10000,                          //volume_request
+    10000,                          //rgb_request
+    5000,                           //personalise_plant
+    10000,                          //fleet_snapshot
+    40000                           //subscribe, held open for up to 25 s
+};
+
+/*              Endpoint Priorities             */
+static const HubClient::Priority endpointPriority[HubClient::EndpointCount] =
+{
+    HubClient::InteractiveRead,             //ribbon_boot, the fleet list is empty until it lands
+    HubClient::InteractiveRead,             //return_macs, after Add is pressed
+    HubClient::BackgroundPoll,              //recent_entry
+    HubClient::InteractiveRead,             //graph_data, a graph is open
+    HubClient::BackgroundPoll,              //data_request, raised by the Refresh button
+    HubClient::InteractiveCommand,          //action_request
+    HubClient::InteractiveCommand,          //audio_request
+    HubClient::InteractiveCommand,          //volume_request
+    HubClient::InteractiveCommand,          //rgb_request
+    HubClient::InteractiveCommand,          //personalise_plant
+    HubClient::BackgroundPoll,              //fleet_snapshot
+    HubClient::BackgroundPoll               //subscribe
+};
+
+static bool isCoalescable(HubClient::Endpoint endpoint)
+{
+    //Two identical reads in flight at once would get the same answer
+    return endpoint == HubClient::RibbonBoot || endpoint == HubClient::ReturnMacs || endpoint == HubClient::RecentEntry ||
+           endpoint == HubClient::GraphData || endpoint == HubClient::DataRequest || endpoint == HubClient::FleetSnapshot;
+}
+
+/*              Retry Policy                    */
+static const int maximumAttempts = 3;
+static const int firstRetryDelay = 500;
+static const int maximumRetryDelay = 4000;
+
+static bool isRetryable(HubClient::Endpoint endpoint)
+{
+    //Repeating these only costs the hub a query; data_request pokes the pot, commands act on it,
+    //and the subscription channel already reopens its own long poll
+    return endpoint == HubClient::RibbonBoot || endpoint == HubClient::ReturnMacs || endpoint == HubClient::RecentEntry ||
+           endpoint == HubClient::GraphData || endpoint == HubClient::FleetSnapshot;
+}
+
+/*               Class Constructor              */
+HubClient::HubClient(QObject *parent) : QObject(parent)
+{
+    networkManagerAddress = new QNetworkAccessManager(this);
+
+    QSettings settings;
+    hubUrl.setUrl(qEnvironmentVariable("BIOBLOOM_HUB_URL",                              //Point at a stand-in hub for testing
+                                       settings.value("hub/url", "http://192.168.5.1:80/").toString()));
+    binaryRecordsFlag = settings.value("hub/binaryRecords", false).toBool();           //Ask for packed sensor rows, hubs without support still send text
+
+    inFlightCount = 0;
+    backgroundInFlightCount = 0;
+    setInFlightLimits(settings.value("hub/maxInFlight", 6).toInt(),                    //Qt opens at most 6 connections to one host anyway
+                      settings.value("hub/maxInFlightPerUnit", 2).toInt());
+
+    setupRequestTemplates();
+
+    for(int i = 0; i < EndpointCount; i++)
+        metricPrefix.append("hub." + QString(endpointScript[i]).remove(".php") + ".");
+
+    networkManagerAddress->connectToHost(hubUrl.host(), hubUrl.port(80));       //Open the first connection before anything needs it
+}
+
+HubClient* HubClient::instance()
+{
+    static HubClient* clientAddress = nullptr;
+
+    if(!clientAddress)
+        clientAddress = new HubClient(QCoreApplication::instance());
+
+    return clientAddress;
+}
+
+
+
+/*              Unit Discovery Endpoints        */
+HubReply* HubClient::ribbonBoot()
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("pointless", "1");
+
+    return post(RibbonBoot, QString(), postQuery);
+}
+
+HubReply* HubClient::returnMacs()
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("pointless", "1");
+
+    return post(ReturnMacs, QString(), postQuery);
+}
+
+/*              Sensor Data Endpoints           */
+HubReply* HubClient::recentEntry(QString macAddress)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+
+    return post(RecentEntry, macAddress, postQuery);
+}
+
+HubReply* HubClient::graphData(QString macAddress, int sinceDataNumber)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+
+    if(sinceDataNumber > 0)
+        postQuery.addQueryItem("since", QString::number(sinceDataNumber));
+
+    return post(GraphData, macAddress, postQuery);
+}
+
+HubReply* HubClient::dataRequest(QString macAddress)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+
+    return post(DataRequest, macAddress, postQuery);
+}
+
+HubReply* HubClient::fleetSnapshot()
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("pointless", "1");
+
+    return post(FleetSnapshot, QString(), postQuery);
+}
+
+HubReply* HubClient::subscribe(QStringList macAddresses, QStringList sinceDataNumbers)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("macs", macAddresses.join(","));
+    postQuery.addQueryItem("since", sinceDataNumbers.join(","));
+
+    return post(Subscribe, QString(), postQuery);
+}
+
+/*              Pot Control Endpoints           */
+HubReply* HubClient::actionRequest(QString macAddress, QString actionID)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+    postQuery.addQueryItem("id", actionID);
+
+    return post(ActionRequest, macAddress, postQuery);
+}
+
+HubReply* HubClient::audioRequest(QString macAddress, QString trackNumber, QString volume)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+    postQuery.addQueryItem("track", trackNumber);
+    postQuery.addQueryItem("volume", volume);
+
+    return post(AudioRequest, macAddress, postQuery);
+}
+
+HubReply* HubClient::volumeRequest(QString macAddress, QString volume)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+    postQuery.addQueryItem("volume", volume);
+
+    return post(VolumeRequest, macAddress, postQuery);
+}
+
+HubReply* HubClient::rgbRequest(QString macAddress, QString r, QString g, QString b)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+    postQuery.addQueryItem("r", r);
+    postQuery.addQueryItem("g", g);
+    postQuery.addQueryItem("b", b);
+
+    return post(RgbRequest, macAddress, postQuery);
+}
+
+HubReply* HubClient::personalisePlant(QString macAddress, QString plantName, QString plantProfile)
+{
+    QUrlQuery postQuery;
+    postQuery.addQueryItem("mac", macAddress);
+    postQuery.addQueryItem("name", plantName);
+    postQuery.addQueryItem("profile", plantProfile);
+
+    return post(PersonalisePlant, macAddress, postQuery);
+}
+
+
+
+/*              Hub Address Methods             */
+QUrl HubClient::getHubUrl()
+{
+    return hubUrl;
+}
+
+void HubClient::setHubUrl(QUrl inputUrl)
+{
+    if(!inputUrl.isValid() || inputUrl == hubUrl)
+        return;
+
+    if(!inputUrl.path().endsWith('/'))
+        inputUrl.setPath(inputUrl.path() + "/");                               //Scripts resolve inside the given directory
+
+    hubUrl = inputUrl;
+
+    setupRequestTemplates();                                                    //Requests already on the wire finish against the old hub
+    networkManagerAddress->connectToHost(hubUrl.host(), hubUrl.port(80));
+}
+
+
+
+/*              Class Methods                   */
+void HubClient::setupRequestTemplates()
+{
+    requestTemplate.resize(EndpointCount);
+
+    for(int i = 0; i < EndpointCount; i++)
+    {
+        QNetworkRequest request(hubUrl.resolved(QUrl(endpointScript[i])));
+        request.setHeader(QNetworkRequest::ContentTypeHeader, "application/x-www-form-urlencoded");
+        request.setRawHeader("Connection", "keep-alive");
+        request.setAttribute(QNetworkRequest::HttpPipeliningAllowedAttribute, i != Subscribe && i != DataRequest);      //Nothing should queue behind a long poll or a pot
+
+        if(endpointPriority[i] == InteractiveCommand)
+            request.setPriority(QNetworkRequest::HighPriority);                 //Also first in line for a free connection
+
+        if(binaryRecordsFlag && (i == RecentEntry || i == GraphData || i == DataRequest))
+            request.setRawHeader("Accept", QByteArray(binaryRecordsType) + ", text/html;q=0.5");
+
+        requestTemplate[i] = request;
+    }
+}
+
+HubReply* HubClient::post(Endpoint endpoint, QString macAddress, const QUrlQuery &postQuery)
+{
+    HubReply* reply = new HubReply(endpoint, macAddress, this);
+
+    reply->postData = postQuery.toString(QUrl::FullyEncoded).toUtf8();
+    activeReplies.append(reply);
+
+    MetricsRegistry::instance()->increment(metricPrefix[endpoint] + "requests");
+    TraceRecorder::instance()->asyncBegin(endpointScript[endpoint], "hub", reply, macAddress);      //Ends when finished() is emitted
+
+    if(isCoalescable(endpoint))
+    {
+        reply->coalescingKey = QByteArray::number(endpoint) + '?' + reply->postData;
+
+        HubReply* leader = outstandingReads.value(reply->coalescingKey);
+
+        if(leader)
+        {
+            reply->state = HubReply::Joined;                                    //Rides along, finished when the leader is
+            reply->joinedFlag = true;
+            reply->leaderAddress = leader;
+            leader->joinedReplies.append(reply);
+
+            MetricsRegistry::instance()->increment(metricPrefix[endpoint] + "joined");
+            return reply;
+        }
+
+        outstandingReads.insert(reply->coalescingKey, reply);
+    }
+
+    enqueue(reply);                                                             //Goes straight out if there is room
+
+    return reply;
+}
+
+
+
+/*              Pipeline Methods                */
+void HubClient::abortAll()
+{
+    QList<HubReply*> replies = activeReplies;                                   //abort() finishes replies, which edits the list
+
+    for(int i = 0; i < replies.count(); i++)
+        if(activeReplies.contains(replies[i]))
+            replies[i]->abort();
+}
+
+int HubClient::getInFlightCount()
+{
+    return inFlightCount;
+}
+
+int HubClient::getQueuedCount()
+{
+    int queued = 0;
+
+    for(int i = 0; i < PriorityCount; i++)
+        queued += waitingQueue[i].count();
+
+    return queued;
+}
+
+void HubClient::setInFlightLimits(int inputTotal, int inputPerUnit)
+{
+    maxInFlight = qMax(1, inputTotal);
+    maxInFlightPerUnit = qBound(1, inputPerUnit, maxInFlight);
+
+    dispatch();                                                                 //A higher limit may free queued requests
+}
+
+void HubClient::enqueue(HubReply* reply)
+{
+    reply->state = HubReply::Queued;
+    waitingQueue[reply->priority].append(reply->macAddress, reply);
+
+    dispatch();
+}
+
+void HubClient::unqueue(HubReply* reply)
+{
+    waitingQueue[reply->priority].remove(reply->macAddress, reply);
+
+    publishQueueGauges();
+}
+
+void HubClient::dispatch()
+{
+    int backgroundLimit = qMax(1, maxInFlight - 1);                             //Leaves a slot free for the user
+
+    while(inFlightCount < maxInFlight)
+    {
+        HubReply* reply = nullptr;
+
+        for(int i = 0; i < PriorityCount && !reply; i++)
+        {
+            if(waitingQueue[i].isEmpty())
+                continue;
+
+            if(i == BackgroundPoll && backgroundInFlightCount >= backgroundLimit)
+                break;
+
+            int unitLimit = (i == InteractiveCommand) ? maxInFlight : maxInFlightPerUnit;      //A command goes even to a busy pot
+
+            reply = waitingQueue[i].takeNext(unitInFlightCount, unitLimit);
+        }
+
+        if(!reply)                                                              //Everything waiting is held by a limit
+            break;
+
+        startReply(reply);
+    }
+
+    publishQueueGauges();
+}
+
+void HubClient::startReply(HubReply* reply)
+{
+    inFlightCount++;
+
+    if(reply->priority == BackgroundPoll)
+        backgroundInFlightCount++;
+
+    if(!reply->macAddress.isEmpty())
+        unitInFlightCount[reply->macAddress]++;
+
+    reply->resetForAttempt();
+    reply->state = HubReply::InFlight;
+    reply->attemptCount++;
+    reply->attachNetworkReply(networkManagerAddress->post(requestTemplate[reply->endpoint], reply->postData));
+    reply->timeoutTimer->start(endpointTimeout[reply->endpoint]);
+    reply->wireClock.start();
+
+    TraceRecorder::instance()->asyncBegin("on the wire", "hub", reply);
+}
+
+void HubClient::releaseReply(HubReply* reply)
+{
+    inFlightCount--;
+
+    if(reply->priority == BackgroundPoll)
+        backgroundInFlightCount--;
+
+    if(!reply->macAddress.isEmpty())
+    {
+        int unitCount = unitInFlightCount.value(reply->macAddress) - 1;
+
+        if(unitCount > 0)
+            unitInFlightCount.insert(reply->macAddress, unitCount);
+        else
+            unitInFlightCount.remove(reply->macAddress);
+    }
+
+    dispatch();
+}
+
+void HubClient::publishQueueGauges()
+{
+    MetricsRegistry* registry = MetricsRegistry::instance();
+
+    registry->setGauge("hub.inFlight", inFlightCount);
+    registry->setGauge("hub.queued", getQueuedCount());
+
+    for(int i = 0; i < PriorityCount; i++)
+        registry->setGauge(QString("hub.queued.class%1").arg(i), waitingQueue[i].count());      //0 commands, 1 reads, 2 polling
+}
+
+void HubClient::forgetReply(HubReply* reply)
+{
+    activeReplies.removeOne(reply);
+
+    if(!reply->coalescingKey.isEmpty() && outstandingReads.value(reply->coalescingKey) == reply)
+        outstandingReads.remove(reply->coalescingKey);                          //Reads posted from now on start afresh
+}
+
+void HubClient::handOverJoinedReplies(HubReply* reply)
+{
+    if(!reply->coalescingKey.isEmpty() && outstandingReads.value(reply->coalescingKey) == reply)
+        outstandingReads.remove(reply->coalescingKey);
+
+    if(reply->joinedReplies.isEmpty())
+        return;
+
+    HubReply* heir = reply->joinedReplies.takeFirst();
+
+    heir->joinedReplies = reply->joinedReplies;
+    reply->joinedReplies.clear();
+
+    heir->leaderAddress = nullptr;
+    heir->joinedFlag = false;
+
+    for(int i = 0; i < heir->joinedReplies.count(); i++)
+        heir->joinedReplies[i]->leaderAddress = heir;
+
+    outstandingReads.insert(heir->coalescingKey, heir);
+    enqueue(heir);                                                              //Starts over on its own
+}
+
+
+
+/*               HubReply Constructor           */
+HubReply::HubReply(HubClient::Endpoint inputEndpoint, QString inputMacAddress, QObject *parent) : QObject(parent),
+                                                                                                 endpoint(inputEndpoint),
+                                                                                                 macAddress(inputMacAddress),
+                                                                                                 clientAddress(qobject_cast<HubClient*>(parent)),
+                                                                                                 state(Queued),
+                                                                                                 priority(endpointPriority[inputEndpoint]),
+                                                                                                 attemptCount(0),
+                                                                                                 timedOutFlag(false),
+                                                                                                 cancelledFlag(false),
+                                                                                                 timeoutTimer(nullptr),
+                                                                                                 retryTimer(nullptr),
+                                                                                                 leaderAddress(nullptr),
+                                                                                                 joinedFlag(false),
+                                                                                                 receivedBytes(0),
+                                                                                                 parseNanoseconds(0),
+                                                                                                 networkReplyAddress(nullptr),
+                                                                                                 errorFlag(false),
+                                                                                                 binaryRecordsFlag(false),
+                                                                                                 recordTimesFlag(false),
+                                                                                                 streamStartedFlag(false),
+                                                                                                 recordsValidFlag(false),
+                                                                                                 lastDataNumber(-1)
+{
+    streamRecordsFlag = (endpoint == HubClient::RecentEntry || endpoint == HubClient::GraphData || endpoint == HubClient::DataRequest);
+
+    postedClock.start();
+}
+
+/*          HubReply Accessor Methods           */
+HubClient::Endpoint HubReply::getEndpoint()
+{
+    return endpoint;
+}
+
+HubReply::State HubReply::getState()
+{
+    return state;
+}
+
+QString HubReply::getMacAddress()
+{
+    return macAddress;
+}
+
+QByteArray HubReply::data()
+{
+    return replyData;
+}
+
+bool HubReply::isError()
+{
+    return errorFlag;
+}
+
+QString HubReply::errorString()
+{
+    return errorText;
+}
+
+bool HubReply::isTimedOut()
+{
+    return timedOutFlag;
+}
+
+bool HubReply::isCancelled()
+{
+    return cancelledFlag;
+}
+
+int HubReply::getAttemptCount()
+{
+    return attemptCount;
+}
+
+bool HubReply::isJoined()
+{
+    return joinedFlag;
+}
+
+HubClient::Priority HubReply::getPriority()
+{
+    return priority;
+}
+
+void HubReply::setPriority(HubClient::Priority inputPriority)
+{
+    if(state == Joined)
+    {
+        if(inputPriority < leaderAddress->priority)
+            leaderAddress->setPriority(inputPriority);                          //The shared request is what has to hurry
+
+        priority = inputPriority;
+        return;
+    }
+
+    if(state == Queued)
+    {
+        clientAddress->unqueue(this);
+        priority = inputPriority;
+        clientAddress->enqueue(this);                                           //May go out straight away in its new class
+        return;
+    }
+
+    if(state == RetryWaiting)
+        priority = inputPriority;                                               //In flight keeps the class it was counted under
+}
+
+int HubReply::getLastDataNumber()
+{
+    return lastDataNumber;
+}
+
+bool HubReply::isBinaryRecords()
+{
+    return binaryRecordsFlag;
+}
+
+bool HubReply::readRecords(SensorRecords &output)
+{
+    if(errorFlag)
+        return false;
+
+    if(streamRecordsFlag)
+    {
+        output = streamRecords;                                                 //Columns are shared, not copied
+        return recordsValidFlag;
+    }
+
+    return output.parse(replyData, binaryRecordsFlag, recordTimesFlag);
+}
+
+/*              HubReply Methods                */
+void HubReply::abort()
+{
+    if(state == Done)
+        return;
+
+    cancelledFlag = true;
+
+    if(state == Joined)
+    {
+        leaderAddress->joinedReplies.removeOne(this);                           //The leader carries on for everyone else
+        leaderAddress = nullptr;
+
+        errorFlag = true;
+        errorText = "Request cancelled";
+
+        complete();
+        return;
+    }
+
+    clientAddress->handOverJoinedReplies(this);                                 //Only this caller gave up
+
+    if(state == InFlight)
+    {
+        networkReplyAddress->abort();                                           //Finishes through networkReplyFinishedSlot
+        return;
+    }
+
+    if(state == Queued)
+        clientAddress->unqueue(this);
+    else
+        retryTimer->stop();
+
+    errorFlag = true;
+    errorText = "Request cancelled";
+
+    complete();
+}
+
+void HubReply::resetForAttempt()
+{
+    replyData.clear();
+    errorFlag = false;
+    errorText.clear();
+    timedOutFlag = false;
+    binaryRecordsFlag = false;
+    recordTimesFlag = false;
+    streamStartedFlag = false;
+    recordsValidFlag = false;
+    streamRecords = SensorRecords();
+    lastDataNumber = -1;
+    receivedBytes = 0;
+    parseNanoseconds = 0;
+
+    if(!timeoutTimer)
+    {
+        timeoutTimer = new QTimer(this);
+        timeoutTimer->setSingleShot(true);
+        connect(timeoutTimer, SIGNAL(timeout()), this, SLOT(timeoutSlot()));
+    }
+}
+
+void HubReply::complete()
+{
+    state = Done;
+    clientAddress->forgetReply(this);
+
+    if(!joinedFlag && attemptCount > 0)                                         //Joined replies are counted by their leader
+    {
+        MetricsRegistry* registry = MetricsRegistry::instance();
+        const QString& prefix = clientAddress->metricPrefix[endpoint];
+
+        registry->record(prefix + "latencyMs", postedClock.nsecsElapsed() / 1e6);
+
+        if(errorFlag)
+            registry->increment(prefix + (cancelledFlag ? "cancelled" : "errors"));
+
+        if(streamRecordsFlag && !errorFlag)
+            registry->record(prefix + "parseMs", parseNanoseconds / 1e6);
+    }
+
+    TraceRecorder::instance()->asyncEnd(endpointScript[endpoint], "hub", this,
+                                        errorFlag ? errorText : (joinedFlag ? QString("joined") : QString("ok")));
+
+    QList<HubReply*> joined = joinedReplies;
+    joinedReplies.clear();
+
+    for(int i = 0; i < joined.count(); i++)
+    {
+        joined[i]->copyResult(this);
+        joined[i]->leaderAddress = nullptr;
+        joined[i]->complete();
+    }
+
+    emit finished(this);
+
+    deleteLater();
+}
+
+void HubReply::copyResult(HubReply* source)
+{
+    replyData = source->replyData;                                              //Implicitly shared, nothing is copied
+    errorFlag = source->errorFlag;
+    errorText = source->errorText;
+    timedOutFlag = source->timedOutFlag;
+    attemptCount = source->attemptCount;
+    binaryRecordsFlag = source->binaryRecordsFlag;
+    recordTimesFlag = source->recordTimesFlag;
+    recordsValidFlag = source->recordsValidFlag;
+    streamRecords = source->streamRecords;
+    lastDataNumber = source->lastDataNumber;
+}
+
+void HubReply::attachNetworkReply(QNetworkReply* inputReply)
+{
+    networkReplyAddress = inputReply;
+
+    connect(networkReplyAddress, SIGNAL(readyRead()), this, SLOT(networkReplyReadyReadSlot()));
+    connect(networkReplyAddress, SIGNAL(finished()), this, SLOT(networkReplyFinishedSlot()));
+}
+
+/*              HubReply Slots                  */
+void HubReply::networkReplyReadyReadSlot()
+{
+    if(!streamRecordsFlag)
+    {
+        QByteArray chunk = networkReplyAddress->readAll();
+        receivedBytes += chunk.size();
+        replyData += chunk;
+        return;
+    }
+
+    TraceSpan span("parse records", "parse", macAddress);
+
+    QElapsedTimer parseClock;
+    parseClock.start();
+
+    if(!streamStartedFlag)                                                      //Headers are in by the first readyRead
+    {
+        binaryRecordsFlag = networkReplyAddress->header(QNetworkRequest::ContentTypeHeader).toString().startsWith(binaryRecordsType);
+        recordTimesFlag = (networkReplyAddress->rawHeader("X-Record-Times") == "1");
+        streamRecords.begin(binaryRecordsFlag, networkReplyAddress->header(QNetworkRequest::ContentLengthHeader).toLongLong(), recordTimesFlag);
+        streamStartedFlag = true;
+    }
+
+    char chunk[4096];
+    qint64 chunkSize;
+
+    while((chunkSize = networkReplyAddress->read(chunk, sizeof(chunk))) > 0)
+    {
+        receivedBytes += chunkSize;
+        streamRecords.feed(chunk, chunkSize);
+    }
+
+    parseNanoseconds += parseClock.nsecsElapsed();
+}
+
+void HubReply::networkReplyFinishedSlot()
+{
+    networkReplyReadyReadSlot();                                                //Whatever arrived after the last readyRead
+
+    if(streamRecordsFlag)
+    {
+        QElapsedTimer parseClock;
+        parseClock.start();
+
+        recordsValidFlag = streamRecords.finish();
+        parseNanoseconds += parseClock.nsecsElapsed();
+    }
+    else
+    {
+        binaryRecordsFlag = networkReplyAddress->header(QNetworkRequest::ContentTypeHeader).toString().startsWith(binaryRecordsType);
+        recordTimesFlag = (networkReplyAddress->rawHeader("X-Record-Times") == "1");
+    }
+
+    if(networkReplyAddress->hasRawHeader("X-Last-Data-Number"))
+        lastDataNumber = networkReplyAddress->rawHeader("X-Last-Data-Number").toInt();
+
+    timeoutTimer->stop();
+
+    QNetworkReply::NetworkError networkError = networkReplyAddress->error();
+    bool transientFlag = (networkError < QNetworkReply::ProxyConnectionRefusedError ||             //Connection trouble or a timeout,
+                          networkError >= QNetworkReply::InternalServerError);                     //or the hub itself failing, not a 404
+
+    if(networkError != QNetworkReply::NoError)
+    {
+        errorFlag = true;
+        errorText = timedOutFlag ? QString("Timed out") : networkReplyAddress->errorString();
+        qCDebug(hubLog) << "hub request failed" << networkReplyAddress->url() << errorText;
+    }
+
+    networkReplyAddress->deleteLater();
+    networkReplyAddress = nullptr;
+
+    MetricsRegistry* registry = MetricsRegistry::instance();
+    const QString& prefix = clientAddress->metricPrefix[endpoint];
+
+    registry->record(prefix + "wireMs", wireClock.nsecsElapsed() / 1e6);
+    TraceRecorder::instance()->asyncEnd("on the wire", "hub", this);
+    registry->increment(prefix + "bytes", receivedBytes);
+
+    if(timedOutFlag)
+        registry->increment(prefix + "timeouts");
+
+    clientAddress->releaseReply(this);                                          //Slot is free before anyone reacts to the result
+
+    if(errorFlag && transientFlag && !cancelledFlag && isRetryable(endpoint) && attemptCount < maximumAttempts)
+    {
+        if(!retryTimer)
+        {
+            retryTimer = new QTimer(this);
+            retryTimer->setSingleShot(true);
+            connect(retryTimer, SIGNAL(timeout()), this, SLOT(retrySlot()));
+        }
+
+        state = RetryWaiting;
+        registry->increment(prefix + "retries");
+        retryTimer->start(qMin(firstRetryDelay << (attemptCount - 1), maximumRetryDelay));
+        return;
+    }
+
+    complete();
+}
+
+void HubReply::timeoutSlot()
+{
+    if(state != InFlight)
+        return;
+
+    timedOutFlag = true;
+    networkReplyAddress->abort();                                               //Finishes through networkReplyFinishedSlot
+}
+
+void HubReply::retrySlot()
+{
+    clientAddress->enqueue(this);
+}
@@ -0,0 +1,252 @@
+/*      Define Header File      */
+#ifndef HUBCLIENT_H
+#define HUBCLIENT_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QVector>
+#include <QList>
+#include <QHash>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+#include <QUrl>
+#include <QUrlQuery>
+#include <QtNetwork/QNetworkAccessManager>
+#include <QtNetwork/QNetworkRequest>
+#include <QtNetwork/QNetworkReply>
+#include <QLoggingCategory>
+
+#include "sensorrecords.h"
+#include "fairrequestqueue.h"
+#include "metricsregistry.h"
+#include "tracerecorder.h"
+
+/*
+ * Every call to the hub goes through the one HubClient. It owns the only
+ * QNetworkAccessManager in the program so the TCP connections to the hub stay
+ * open between requests instead of being rebuilt for every POST.
+ *
+ * Each method returns a HubReply. Connect its finished(HubReply*) signal to a
+ * slot and read data() in there; the HubReply deletes itself afterwards, so the
+ * slot must not keep the pointer. Commands that nobody waits on can ignore the
+ * returned reply. Replies from the sensor endpoints (recent_entry, graph_data,
+ * data_request) are parsed as the bytes arrive and are read with readRecords()
+ * instead of data().
+ *
+ * Requests are queued and only put on the wire while fewer than hub/maxInFlight
+ * are outstanding in total and fewer than hub/maxInFlightPerUnit for the same
+ * pot, so an offline pot cannot tie up every connection. Each endpoint has its
+ * own timeout. Reads that are safe to repeat are retried a few times with a
+ * doubling delay before finished() reports the error; commands are never
+ * repeated. abort() cancels a request wherever it is, and finished() is still
+ * emitted with isError() set.
+ *
+ * A read posted while an identical one (same endpoint, same fields) is still
+ * outstanding joins it instead of going over the wire again. Each caller still
+ * gets its own HubReply carrying the shared result, and cancelling one caller's
+ * reply does not cancel the others.
+ *
+ * Waiting requests go out by priority: commands to a pot first, then reads a
+ * user is waiting on, then background polling, with the pots taking turns within
+ * each class. Background polling never takes the last free slot, and commands
+ * are not held back by the per-pot limit, so a button press is not stuck behind
+ * a fleet sweep. Each endpoint has a default class; HubReply::setPriority()
+ * moves a request that is still waiting.
+ *
+ * The hub is at hub/url unless BIOBLOOM_HUB_URL or setHubUrl() says otherwise.
+ */
+
+Q_DECLARE_LOGGING_CATEGORY(hubLog)                              //"biobloom.hub", off below warnings unless QT_LOGGING_RULES enables it
+
+/*          Class Declarations          */
+class HubReply;
+class HubClient : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Endpoint
+    {
+        RibbonBoot,
+        ReturnMacs,
+        RecentEntry,
+        GraphData,
+        DataRequest,
+        ActionRequest,
+        AudioRequest,
+        VolumeRequest,
+        RgbRequest,
+        PersonalisePlant,
+        FleetSnapshot,
+        Subscribe,
+        EndpointCount
+    };
+
+    enum Priority
+    {
+        InteractiveCommand,                                     //User acting on a pot
+        InteractiveRead,                                        //User waiting to see something
+        BackgroundPoll,                                         //Keeping the fleet up to date
+        PriorityCount
+    };
+
+    static HubClient* instance();                               //Application wide client, created on first use
+
+    /*          Hub Address Methods                 */
+    QUrl getHubUrl();
+    void setHubUrl(QUrl inputUrl);                              //Later requests go to this hub, e.g. a local stand-in
+
+    /*          Unit Discovery Endpoints            */
+    HubReply* ribbonBoot();
+    HubReply* returnMacs();
+
+    /*          Sensor Data Endpoints               */
+    HubReply* recentEntry(QString macAddress);
+    HubReply* graphData(QString macAddress, int sinceDataNumber = 0);       //Only rows after sinceDataNumber when it is set
+    HubReply* dataRequest(QString macAddress);
+    HubReply* fleetSnapshot();                                  //Newest reading of every owned unit in one reply
+    HubReply* subscribe(QStringList macAddresses, QStringList sinceDataNumbers);     //Long poll, held open until a newer row lands
+
+    /*          Pot Control Endpoints               */
+    HubReply* actionRequest(QString macAddress, QString actionID);
+    HubReply* audioRequest(QString macAddress, QString trackNumber, QString volume);
+    HubReply* volumeRequest(QString macAddress, QString volume);
+    HubReply* rgbRequest(QString macAddress, QString r, QString g, QString b);
+    HubReply* personalisePlant(QString macAddress, QString plantName, QString plantProfile);
+
+    /*          Pipeline Methods                    */
+    void abortAll();                                            //Cancel everything queued, waiting to retry or in flight
+    int getInFlightCount();
+    int getQueuedCount();
+    void setInFlightLimits(int inputTotal, int inputPerUnit);
+
+private:
+    friend class HubReply;                                      //Replies move themselves through the pipeline
+
+    explicit HubClient(QObject *parent = nullptr);
+
+    QNetworkAccessManager* networkManagerAddress;
+    QUrl hubUrl;
+    bool binaryRecordsFlag;                                    //Sensor endpoints offer to take packed binary rows
+    QVector<QNetworkRequest> requestTemplate;                  //One prebuilt request per endpoint
+    QVector<QString> metricPrefix;                             //"hub.graph_data." and so on, per endpoint
+
+    FairRequestQueue waitingQueue[PriorityCount];              //Posted or due a retry, not yet on the wire
+    QList<HubReply*> activeReplies;                            //Every reply that has not finished yet
+    int inFlightCount;
+    int backgroundInFlightCount;
+    QHash<QString, int> unitInFlightCount;                     //Per pot MAC, requests without one are only counted in total
+    int maxInFlight;
+    int maxInFlightPerUnit;
+    QHash<QByteArray, HubReply*> outstandingReads;             //Endpoint and fields -> the reply doing the work for everyone asking
+
+    void setupRequestTemplates();
+    HubReply* post(Endpoint endpoint, QString macAddress, const QUrlQuery &postQuery);
+
+    /*          Pipeline Methods                    */
+    void enqueue(HubReply* reply);
+    void unqueue(HubReply* reply);
+    void dispatch();
+    void startReply(HubReply* reply);
+    void releaseReply(HubReply* reply);                         //Gives back the in-flight slot of a reply that left the wire
+    void forgetReply(HubReply* reply);
+    void handOverJoinedReplies(HubReply* reply);               //Another caller takes over a read that is being cancelled
+    void publishQueueGauges();
+};
+
+class HubReply : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum State
+    {
+        Queued,
+        InFlight,
+        RetryWaiting,
+        Joined,                                                 //Waiting on an identical read another caller started
+        Done
+    };
+
+    explicit HubReply(HubClient::Endpoint inputEndpoint, QString inputMacAddress, QObject *parent = nullptr);
+
+    HubClient::Endpoint getEndpoint();
+    QString getMacAddress();
+    State getState();                                           //InFlight once the request has been handed to the network
+
+    QByteArray data();
+    bool isError();
+    QString errorString();
+    bool isTimedOut();
+    bool isCancelled();
+    int getAttemptCount();                                      //1 unless the request had to be retried
+
+    HubClient::Priority getPriority();
+    void setPriority(HubClient::Priority inputPriority);        //Only changes the order of requests still waiting
+    bool isJoined();                                            //Result came from another caller's identical request
+
+    int getLastDataNumber();                                    //Newest data_number the hub holds or sent, -1 if it did not say
+
+    bool isBinaryRecords();                                     //Hub answered with packed rows instead of text
+    bool readRecords(SensorRecords &output);                    //Sensor rows in either format
+
+    void abort();                                               //Cancel, wherever the request has got to
+
+signals:
+    void finished(HubReply* reply);
+
+public slots:
+    void networkReplyReadyReadSlot();
+    void networkReplyFinishedSlot();
+    void timeoutSlot();
+    void retrySlot();
+
+private:
+    friend class HubClient;
+
+    HubClient::Endpoint endpoint;
+    QString macAddress;
+    HubClient* clientAddress;
+    State state;
+    HubClient::Priority priority;
+
+    QByteArray postData;                                        //Kept for retries
+    int attemptCount;
+    bool timedOutFlag;
+    bool cancelledFlag;
+    QTimer* timeoutTimer;                                       //Built on first dispatch
+    QTimer* retryTimer;                                         //Built on first retry
+
+    QByteArray coalescingKey;                                   //Empty for requests that are never merged
+    HubReply* leaderAddress;                                    //Reply this one joined, while Joined
+    QList<HubReply*> joinedReplies;                             //Callers sharing this reply's request
+    bool joinedFlag;
+
+    QElapsedTimer postedClock;                                  //From post() to finished(), queueing and retries included
+    QElapsedTimer wireClock;                                    //Current attempt only
+    qint64 receivedBytes;
+    qint64 parseNanoseconds;
+
+    QNetworkReply* networkReplyAddress;
+    QByteArray replyData;
+    bool errorFlag;
+    QString errorText;
+    bool binaryRecordsFlag;
+    bool recordTimesFlag;                                      //Text rows start with the time the hub stored them
+
+    bool streamRecordsFlag;                                     //Sensor endpoint, parsed chunk by chunk
+    bool streamStartedFlag;
+    bool recordsValidFlag;
+    SensorRecords streamRecords;
+    int lastDataNumber;
+
+    void attachNetworkReply(QNetworkReply* inputReply);
+    void resetForAttempt();
+    void complete();                                            //Emit finished() and delete later
+    void copyResult(HubReply* source);
+};
+
+#endif // HUBCLIENT_H
@@ -0,0 +1,115 @@
+/*                  Header File                 */
+#include "hubfieldreader.h"
+#include <QtGlobal>
+#include <cmath>
+
+/*               Class Constructor              */
+HubFieldReader::HubFieldReader(const QByteArray &inputData) : replyData(inputData)
+{
+    cursor = replyData.constData();
+    end = cursor + replyData.size();
+}
+
+
+
+/*              Class Methods                   */
+bool HubFieldReader::next(QLatin1String &field)
+{
+    while(cursor < end)
+    {
+        const char* fieldStart = cursor;
+
+        while(cursor < end && *cursor != ',')
+            cursor++;
+
+        const char* fieldEnd = cursor;
+
+        if(cursor < end)
+            cursor++;                                                           //Step over the comma
+
+        while(fieldStart < fieldEnd && (*fieldStart == ' ' || *fieldStart == '\r' || *fieldStart == '\n' || *fieldStart == '\t'))
+            fieldStart++;
+
+        while(fieldEnd > fieldStart && (fieldEnd[-1] == ' ' || fieldEnd[-1] == '\r' || fieldEnd[-1] == '\n' || fieldEnd[-1] == '\t'))
+            fieldEnd--;
+
+        if(fieldEnd > fieldStart)
+        {
+            field = QLatin1String(fieldStart, (int)(fieldEnd - fieldStart));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool HubFieldReader::skip(int fieldCount)
+{
+    QLatin1String field;
+
+    for(int i = 0; i < fieldCount; i++)
+        if(!next(field))
+            return false;
+
+    return true;
+}
+
+double HubFieldReader::toNumber(QLatin1String field, bool* ok)
+{
+    const char* c = field.data();
+    const char* fieldEnd = c + field.size();
+
+    bool negativeFlag = false;
+    bool digitsFlag = false;
+    double value = 0;
+    double scale = 1;
+
+    if(c < fieldEnd && (*c == '-' || *c == '+'))
+        negativeFlag = (*c++ == '-');
+
+    for(; c < fieldEnd && *c >= '0' && *c <= '9'; c++)
+    {
+        value = value * 10 + (*c - '0');
+        digitsFlag = true;
+    }
+
+    if(c < fieldEnd && *c == '.')
+        for(c++; c < fieldEnd && *c >= '0' && *c <= '9'; c++)
+        {
+            scale /= 10;
+            value += (*c - '0') * scale;
+            digitsFlag = true;
+        }
+
+    if(digitsFlag && c < fieldEnd && (*c == 'e' || *c == 'E'))
+    {
+        const char* exponentStart = c++;
+        bool negativeExponentFlag = false;
+        bool exponentDigitsFlag = false;
+        int exponent = 0;
+
+        if(c < fieldEnd && (*c == '-' || *c == '+'))
+            negativeExponentFlag = (*c++ == '-');
+
+        for(; c < fieldEnd && *c >= '0' && *c <= '9'; c++)
+        {
+            exponent = qMin(exponent * 10 + (*c - '0'), 9999);                  //Far past the range of a double either way
+            exponentDigitsFlag = true;
+        }
+
+        if(exponentDigitsFlag)
+            value *= std::pow(10.0, negativeExponentFlag ? -exponent : exponent);
+        else
+            c = exponentStart;                                                  //A bare "e" is trailing garbage
+    }
+
+    bool validFlag = digitsFlag && c == fieldEnd;                              //"-", "." and "12abc" are not numbers
+
+    if(ok)
+        *ok = validFlag;
+
+    if(!validFlag)
+        return 0;
+
+    return negativeFlag ? -value : value;
+}
@@ -0,0 +1,34 @@
+/*      Define Header File      */
+#ifndef HUBFIELDREADER_H
+#define HUBFIELDREADER_H
+
+/*      Library Classes         */
+#include <QByteArray>
+#include <QLatin1String>
+
+/*
+ * Walks the comma separated fields of a hub reply in place. Each field is
+ * handed out as a QLatin1String pointing into the reply, so nothing is copied
+ * unless the caller keeps it as a QString. Empty fields (",,", a trailing
+ * comma) are skipped, which is what every caller used to do by hand.
+ * Qt 5 has no QByteArrayView, QLatin1String plays that role here.
+ */
+
+/*          Class Declarations          */
+class HubFieldReader
+{
+public:
+    explicit HubFieldReader(const QByteArray &inputData);
+
+    bool next(QLatin1String &field);                            //False when no fields are left
+    bool skip(int fieldCount);                                  //Steps over fields the caller does not need
+
+    static double toNumber(QLatin1String field, bool* ok = nullptr);     //Parses in place what QString::toDouble would accept, 0 and ok false for anything else
+
+private:
+    QByteArray replyData;                                       //Shares the reply's buffer so the fields stay valid
+    const char* cursor;
+    const char* end;
+};
+
+#endif // HUBFIELDREADER_H
@@ -0,0 +1,239 @@
+/*                  Header File                 */
+#include "metricsregistry.h"
+#include <QJsonDocument>
+#include <QFile>
+#include <QDebug>
+
+/*              Histogram Buckets               */
+static const double bucketEdge[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000, 60000};      //Milliseconds
+static const int bucketEdgeCount = sizeof(bucketEdge) / sizeof(bucketEdge[0]);
+
+
+
+/*          Histogram Constructor               */
+LatencyHistogram::LatencyHistogram() : bucketCount(bucketEdgeCount + 1, 0),
+                                       sampleCount(0),
+                                       sampleSum(0),
+                                       sampleMinimum(0),
+                                       sampleMaximum(0)
+{
+}
+
+/*              Histogram Methods               */
+void LatencyHistogram::record(double milliseconds)
+{
+    int bucket = 0;
+
+    while(bucket < bucketEdgeCount && milliseconds > bucketEdge[bucket])
+        bucket++;
+
+    bucketCount[bucket]++;
+
+    sampleMinimum = sampleCount ? qMin(sampleMinimum, milliseconds) : milliseconds;
+    sampleMaximum = sampleCount ? qMax(sampleMaximum, milliseconds) : milliseconds;
+    sampleSum += milliseconds;
+    sampleCount++;
+}
+
+qint64 LatencyHistogram::count() const
+{
+    return sampleCount;
+}
+
+double LatencyHistogram::mean() const
+{
+    return sampleCount ? sampleSum / sampleCount : 0;
+}
+
+double LatencyHistogram::minimum() const
+{
+    return sampleMinimum;
+}
+
+double LatencyHistogram::maximum() const
+{
+    return sampleMaximum;
+}
+
+double LatencyHistogram::percentile(double fraction) const
+{
+    if(!sampleCount)
+        return 0;
+
+    qint64 wanted = qMax<qint64>(1, (qint64)(fraction * sampleCount + 0.5));
+    qint64 seen = 0;
+
+    for(int i = 0; i < bucketEdgeCount; i++)
+    {
+        seen += bucketCount[i];
+
+        if(seen >= wanted)
+            return qMin(bucketEdge[i], sampleMaximum);                          //Never report more than was actually seen
+    }
+
+    return sampleMaximum;
+}
+
+QJsonObject LatencyHistogram::toJson() const
+{
+    QJsonObject output;
+
+    output.insert("count", (double)sampleCount);
+    output.insert("mean", mean());
+    output.insert("min", sampleMinimum);
+    output.insert("max", sampleMaximum);
+    output.insert("p50", percentile(0.5));
+    output.insert("p90", percentile(0.9));
+    output.insert("p99", percentile(0.99));
+
+    return output;
+}
+
+
+
+/*          Registry Constructor                */
+MetricsRegistry::MetricsRegistry()
+{
+    uptimeClock.start();
+}
+
+MetricsRegistry* MetricsRegistry::instance()
+{
+    static MetricsRegistry registry;
+
+    return &registry;
+}
+
+/*          Recording Methods                   */
+void MetricsRegistry::increment(const QString& name, qint64 amount)
+{
+    counterValue[name] += amount;
+}
+
+void MetricsRegistry::setGauge(const QString& name, double value)
+{
+    gaugeValue[name] = value;
+}
+
+void MetricsRegistry::record(const QString& name, double milliseconds)
+{
+    histogramValue[name].record(milliseconds);
+}
+
+void MetricsRegistry::markUnitSeen(const QString& macAddress)
+{
+    unitLastSeen[macAddress] = QDateTime::currentMSecsSinceEpoch();
+}
+
+/*          Reading Methods                     */
+qint64 MetricsRegistry::counter(const QString& name) const
+{
+    return counterValue.value(name);
+}
+
+double MetricsRegistry::gauge(const QString& name) const
+{
+    return gaugeValue.value(name);
+}
+
+LatencyHistogram MetricsRegistry::histogram(const QString& name) const
+{
+    return histogramValue.value(name);
+}
+
+QStringList MetricsRegistry::counterNames() const
+{
+    QStringList names = counterValue.keys();
+    names.sort();
+
+    return names;
+}
+
+QStringList MetricsRegistry::gaugeNames() const
+{
+    QStringList names = gaugeValue.keys();
+    names.sort();
+
+    return names;
+}
+
+QStringList MetricsRegistry::histogramNames() const
+{
+    QStringList names = histogramValue.keys();
+    names.sort();
+
+    return names;
+}
+
+QHash<QString, double> MetricsRegistry::unitAgeSeconds() const
+{
+    QHash<QString, double> ages;
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+    QHash<QString, qint64>::const_iterator i;
+    for(i = unitLastSeen.constBegin(); i != unitLastSeen.constEnd(); ++i)
+        ages.insert(i.key(), (now - i.value()) / 1000.0);
+
+    return ages;
+}
+
+double MetricsRegistry::uptimeSeconds() const
+{
+    return uptimeClock.elapsed() / 1000.0;
+}
+
+QJsonObject MetricsRegistry::toJson() const
+{
+    QJsonObject counters;
+    QJsonObject rates;
+    QJsonObject gauges;
+    QJsonObject histograms;
+    QJsonObject units;
+
+    double uptime = qMax(0.001, uptimeSeconds());
+
+    QHash<QString, qint64>::const_iterator counterIterator;
+    for(counterIterator = counterValue.constBegin(); counterIterator != counterValue.constEnd(); ++counterIterator)
+    {
+        counters.insert(counterIterator.key(), (double)counterIterator.value());
+        rates.insert(counterIterator.key(), counterIterator.value() / uptime);      //Per second, averaged since start
+    }
+
+    QHash<QString, double>::const_iterator gaugeIterator;
+    for(gaugeIterator = gaugeValue.constBegin(); gaugeIterator != gaugeValue.constEnd(); ++gaugeIterator)
+        gauges.insert(gaugeIterator.key(), gaugeIterator.value());
+
+    QHash<QString, LatencyHistogram>::const_iterator histogramIterator;
+    for(histogramIterator = histogramValue.constBegin(); histogramIterator != histogramValue.constEnd(); ++histogramIterator)
+        histograms.insert(histogramIterator.key(), histogramIterator.value().toJson());
+
+    QHash<QString, double> ages = unitAgeSeconds();
+    QHash<QString, double>::const_iterator ageIterator;
+    for(ageIterator = ages.constBegin(); ageIterator != ages.constEnd(); ++ageIterator)
+        units.insert(ageIterator.key(), ageIterator.value());
+
+    QJsonObject output;
+    output.insert("uptimeSeconds", uptime);
+    output.insert("counters", counters);
+    output.insert("ratesPerSecond", rates);
+    output.insert("gauges", gauges);
+    output.insert("histogramsMs", histograms);
+    output.insert("unitLastSeenSeconds", units);
+
+    return output;
+}
+
+bool MetricsRegistry::writeJson(const QString& path) const
+{
+    QFile outputFile(path);
+
+    if(!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qDebug() << "Metrics could not be written to" << path;
+        return false;
+    }
+
+    outputFile.write(QJsonDocument(toJson()).toJson());
+
+    return true;
+}
@@ -0,0 +1,82 @@
+/*      Define Header File      */
+#ifndef METRICSREGISTRY_H
+#define METRICSREGISTRY_H
+
+/*      Library Classes         */
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QVector>
+#include <QElapsedTimer>
+#include <QDateTime>
+#include <QJsonObject>
+
+/*
+ * Counters, gauges and latency histograms for the whole client, plus when each
+ * pot was last heard from. Names are dotted, e.g. hub.graph_data.latencyMs. Only
+ * touched from the main thread. The diagnostics window shows it live and
+ * toJson() gives the same numbers as a JSON document; if diagnostics/metricsFile
+ * is set the document is also written there when the program exits.
+ */
+
+/*          Class Declarations          */
+class LatencyHistogram
+{
+
+public:
+    LatencyHistogram();
+
+    void record(double milliseconds);
+
+    qint64 count() const;
+    double mean() const;
+    double minimum() const;
+    double maximum() const;
+    double percentile(double fraction) const;                   //Upper edge of the bucket holding it, 0.99 for p99
+
+    QJsonObject toJson() const;
+
+private:
+    QVector<qint64> bucketCount;                                //One per bucket edge plus one for anything slower
+    qint64 sampleCount;
+    double sampleSum;
+    double sampleMinimum;
+    double sampleMaximum;
+};
+
+class MetricsRegistry
+{
+
+public:
+    static MetricsRegistry* instance();                         //Application wide registry, created on first use
+
+    /*          Recording Methods                   */
+    void increment(const QString& name, qint64 amount = 1);
+    void setGauge(const QString& name, double value);
+    void record(const QString& name, double milliseconds);      //One sample into a latency histogram
+    void markUnitSeen(const QString& macAddress);
+
+    /*          Reading Methods                     */
+    qint64 counter(const QString& name) const;
+    double gauge(const QString& name) const;
+    LatencyHistogram histogram(const QString& name) const;
+    QStringList counterNames() const;
+    QStringList gaugeNames() const;
+    QStringList histogramNames() const;
+    QHash<QString, double> unitAgeSeconds() const;              //Seconds since each pot's last reading
+    double uptimeSeconds() const;
+
+    QJsonObject toJson() const;
+    bool writeJson(const QString& path) const;
+
+private:
+    MetricsRegistry();
+
+    QElapsedTimer uptimeClock;
+    QHash<QString, qint64> counterValue;
+    QHash<QString, double> gaugeValue;
+    QHash<QString, LatencyHistogram> histogramValue;
+    QHash<QString, qint64> unitLastSeen;                        //Milliseconds since the epoch
+};
+
+#endif // METRICSREGISTRY_H
@@ -0,0 +1,117 @@
+/*                  Header File                 */
+#include "plantprofilecatalog.h"
+#include <QFile>
+#include <QSettings>
+#include <QDebug>
+#include "tracerecorder.h"
+
+/*               Class Constructor              */
+PlantProfileCatalog::PlantProfileCatalog()
+{
+    TraceSpan span("plant profile catalog", "startup");
+
+    setupBuiltInProfiles();
+
+    QSettings settings;
+    QString dataFile = settings.value("profiles/dataFile").toString();         //Custom species, none by default
+
+    if(!dataFile.isEmpty())
+        loadDataFile(dataFile);
+
+    defaultProfileAddress = profileByName.value("Default");
+}
+
+PlantProfileCatalog* PlantProfileCatalog::instance()
+{
+    static PlantProfileCatalog catalog;
+
+    return &catalog;
+}
+
+
+
+/*              Class Methods                   */
+PlantProfilePointer PlantProfileCatalog::profile(const QString& inputName) const
+{
+    return profileByName.value(inputName, defaultProfileAddress);
+}
+
+PlantProfilePointer PlantProfileCatalog::defaultProfile() const
+{
+    return defaultProfileAddress;
+}
+
+bool PlantProfileCatalog::contains(const QString& inputName) const
+{
+    return profileByName.contains(inputName);
+}
+
+QStringList PlantProfileCatalog::profileNames() const
+{
+    return orderedNames;
+}
+
+void PlantProfileCatalog::addProfile(const QString& inputName, int inputTemp, int inputLight, int inputMoisture, int inputHumidity)
+{
+    if(!profileByName.contains(inputName))
+        orderedNames.append(inputName);
+
+    profileByName.insert(inputName, PlantProfilePointer(new PlantProfile(inputName, inputTemp, inputLight, inputMoisture, inputHumidity)));
+}
+
+void PlantProfileCatalog::setupBuiltInProfiles()
+{
+    /*      Default     */
+    addProfile("Default",24,70,60,45);
+
+    /*      Cactus      */
+    addProfile("Aloe Cactus",26,65,35,45);
+
+    /*   Spider Plant   */
+    addProfile("Spider Plant",22,65,60,45);
+
+    /*    Peace Lily    */
+    addProfile("Peace Lily",24,65,60,50);
+
+    /*  Venus Fly Trap  */
+    addProfile("Venus Fly Trap",27,65,75,60);
+}
+
+void PlantProfileCatalog::loadDataFile(const QString& inputPath)
+{
+    QFile dataFile(inputPath);
+
+    if(!dataFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        qDebug() << "Plant profile file" << inputPath << "could not be opened";
+        return;
+    }
+
+    int lineNumber = 0;
+
+    while(!dataFile.atEnd())
+    {
+        QString line = QString::fromUtf8(dataFile.readLine()).trimmed();
+        lineNumber++;
+
+        if(line.isEmpty() || line.startsWith('#'))
+            continue;
+
+        QStringList fields = line.split(',');
+        bool validFlag = (fields.count() == 5);
+        int ideal[4];
+
+        for(int i = 0; validFlag && i < 4; i++)
+            ideal[i] = fields[i + 1].trimmed().toInt(&validFlag);
+
+        QString name = fields[0].trimmed();
+
+        if(!validFlag || name.isEmpty())
+        {
+            qDebug() << "Skipping plant profile on line" << lineNumber << "of" << inputPath;
+            continue;
+        }
+
+        addProfile(name, ideal[0], ideal[1], ideal[2], ideal[3]);
+    }
+}
@@ -0,0 +1,49 @@
+/*      Define Header File      */
+#ifndef PLANTPROFILECATALOG_H
+#define PLANTPROFILECATALOG_H
+
+/*      Library Classes         */
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSharedPointer>
+
+#include "plantprofile.h"
+
+/*
+ * Every plant profile the program knows about, loaded once on first use. The
+ * built-in species come first, then any custom species from the data file named
+ * by the profiles/dataFile setting, one per line as
+ * name,temperature,light,moisture,humidity (lines starting with # are skipped,
+ * a custom species with a built-in name replaces it). Profiles never change once
+ * loaded, so units and windows hold a shared pointer into the catalog instead of
+ * their own copy. Unknown names fall back to the Default profile.
+ */
+
+typedef QSharedPointer<const PlantProfile> PlantProfilePointer;
+
+/*          Class Declarations          */
+class PlantProfileCatalog
+{
+
+public:
+    static PlantProfileCatalog* instance();                     //Application wide catalog, loaded on first use
+
+    PlantProfilePointer profile(const QString& inputName) const; //Default profile if the name is unknown
+    PlantProfilePointer defaultProfile() const;
+    bool contains(const QString& inputName) const;
+    QStringList profileNames() const;                           //Built-in species first, then custom ones in file order
+
+private:
+    PlantProfileCatalog();
+
+    QHash<QString, PlantProfilePointer> profileByName;
+    QStringList orderedNames;
+    PlantProfilePointer defaultProfileAddress;
+
+    void addProfile(const QString& inputName, int inputTemp, int inputLight, int inputMoisture, int inputHumidity);
+    void setupBuiltInProfiles();
+    void loadDataFile(const QString& inputPath);
+};
+
+#endif // PLANTPROFILECATALOG_H
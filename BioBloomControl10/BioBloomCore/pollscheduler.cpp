@@ -0,0 +1,203 @@
+/*                  Header File                 */
+#include "pollscheduler.h"
+#include <QRandomGenerator>
+#include <QDebug>
+
+/*          Constructor and Destructor          */
+PollScheduler::PollScheduler(QObject *parent) : QObject(parent)
+{
+    wakeTimer = new QTimer(this);
+    wakeTimer->setSingleShot(true);
+    wakeTimer->setTimerType(Qt::CoarseTimer);
+
+    pollInterval = 60000;
+    minimumInterval = 15000;
+    maximumInterval = 600000;
+    jitterFraction = 0.1;
+    runningFlag = false;
+
+    schedulerClock.start();
+
+    connect(wakeTimer, SIGNAL(timeout()), this, SLOT(pollDueWorkersSlot()));
+}
+
+PollScheduler::~PollScheduler()
+{
+    stop();
+}
+
+
+
+/*              Class Methods                   */
+void PollScheduler::addWorker(UnitWorker* inputWorker)
+{
+    if(workerDeadline.contains(inputWorker))
+        return;
+
+    connect(inputWorker, SIGNAL(destroyed(QObject*)), this, SLOT(workerDestroyedSlot(QObject*)));
+    connect(inputWorker, SIGNAL(pollIntervalShortened(UnitWorker*)), this, SLOT(workerIntervalShortenedSlot(UnitWorker*)));
+
+    inputWorker->setIntervalBounds(minimumInterval, maximumInterval, pollInterval);
+
+    //First poll lands somewhere in the coming interval so units added together are staggered
+    qint64 firstDeadline = schedulerClock.elapsed() + QRandomGenerator::global()->bounded(pollInterval);
+
+    scheduleWorker(inputWorker, firstDeadline);
+    armTimer();
+}
+
+void PollScheduler::removeWorker(UnitWorker* inputWorker)
+{
+    disconnect(inputWorker, SIGNAL(destroyed(QObject*)), this, SLOT(workerDestroyedSlot(QObject*)));
+    disconnect(inputWorker, SIGNAL(pollIntervalShortened(UnitWorker*)), this, SLOT(workerIntervalShortenedSlot(UnitWorker*)));
+
+    unscheduleWorker(inputWorker);
+    armTimer();
+}
+
+void PollScheduler::start()
+{
+    runningFlag = true;
+    armTimer();
+}
+
+void PollScheduler::stop()
+{
+    runningFlag = false;
+    wakeTimer->stop();
+}
+
+bool PollScheduler::isRunning()
+{
+    return runningFlag;
+}
+
+void PollScheduler::scheduleWorker(UnitWorker* inputWorker, qint64 deadline)
+{
+    deadlineQueue.insert(deadline, inputWorker);
+    workerDeadline.insert(inputWorker, deadline);
+}
+
+void PollScheduler::unscheduleWorker(UnitWorker* inputWorker)
+{
+    if(!workerDeadline.contains(inputWorker))
+        return;
+
+    deadlineQueue.remove(workerDeadline.take(inputWorker), inputWorker);
+}
+
+qint64 PollScheduler::jitteredDeadline(qint64 from, int interval)
+{
+    int spread = (int)(interval * jitterFraction);
+
+    if(spread <= 0)
+        return from + interval;
+
+    return from + interval - spread + QRandomGenerator::global()->bounded(2 * spread + 1);
+}
+
+void PollScheduler::armTimer()
+{
+    if(!runningFlag || deadlineQueue.isEmpty())
+    {
+        wakeTimer->stop();
+        return;
+    }
+
+    qint64 wait = deadlineQueue.firstKey() - schedulerClock.elapsed();
+
+    wakeTimer->start((int)qMax<qint64>(0, wait));
+}
+
+
+
+/*          Timing Accessor Methods             */
+int PollScheduler::getPollInterval()
+{
+    return pollInterval;
+}
+
+int PollScheduler::getMinimumInterval()
+{
+    return minimumInterval;
+}
+
+int PollScheduler::getMaximumInterval()
+{
+    return maximumInterval;
+}
+
+double PollScheduler::getJitterFraction()
+{
+    return jitterFraction;
+}
+
+/*          Timing Mutator Methods              */
+void PollScheduler::setPollInterval(int inputInterval)
+{
+    pollInterval = qBound(minimumInterval, inputInterval, maximumInterval);
+}
+
+void PollScheduler::setIntervalBounds(int inputMinimum, int inputMaximum)
+{
+    minimumInterval = qMax(1000, inputMinimum);
+    maximumInterval = qMax(minimumInterval, inputMaximum);
+    pollInterval = qBound(minimumInterval, pollInterval, maximumInterval);
+
+    QList<UnitWorker*> workers = workerDeadline.keys();
+
+    for(int i = 0; i < workers.count(); i++)
+        workers[i]->setIntervalBounds(minimumInterval, maximumInterval, workers[i]->getPollInterval());
+}
+
+void PollScheduler::setJitterFraction(double inputFraction)
+{
+    jitterFraction = qBound(0.0, inputFraction, 0.5);
+}
+
+
+
+/*              Class Slots                     */
+void PollScheduler::pollDueWorkersSlot()
+{
+    if(!runningFlag)
+        return;
+
+    qint64 now = schedulerClock.elapsed();
+
+    while(!deadlineQueue.isEmpty() && deadlineQueue.firstKey() <= now)
+    {
+        UnitWorker* dueWorker = deadlineQueue.first();
+        unscheduleWorker(dueWorker);
+
+        scheduleWorker(dueWorker, jitteredDeadline(now, dueWorker->getPollInterval()));     //Rescheduled first so a worker removed by its own poll stays removed
+
+        dueWorker->poll();
+
+        if(!runningFlag)                                                   //poll() may have led to stop()
+            return;
+    }
+
+    armTimer();
+}
+
+void PollScheduler::workerIntervalShortenedSlot(UnitWorker* shortenedWorker)
+{
+    if(!workerDeadline.contains(shortenedWorker))
+        return;
+
+    qint64 newDeadline = jitteredDeadline(schedulerClock.elapsed(), shortenedWorker->getPollInterval());
+
+    if(newDeadline >= workerDeadline.value(shortenedWorker))                //Already due sooner than that
+        return;
+
+    unscheduleWorker(shortenedWorker);
+    scheduleWorker(shortenedWorker, newDeadline);
+    armTimer();
+}
+
+void PollScheduler::workerDestroyedSlot(QObject* destroyedWorker)
+{
+    unscheduleWorker(static_cast<UnitWorker*>(destroyedWorker));           //Only used as a key, never dereferenced
+    armTimer();
+}
@@ -0,0 +1,74 @@
+/*      Define Header File      */
+#ifndef POLLSCHEDULER_H
+#define POLLSCHEDULER_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QTimer>
+#include <QMultiMap>
+#include <QHash>
+#include <QElapsedTimer>
+
+#include "unitworker.h"
+
+/*
+ * Drives every UnitWorker from one timer on the main event loop. Each worker
+ * keeps its own deadline; the timer is always armed for the earliest one, and
+ * every new deadline gets a little random jitter so a large fleet does not poll
+ * in lock step. Each worker picks its own interval between the scheduler's
+ * bounds from how fast its readings move. stop() cancels everything at once.
+ */
+
+/*          Class Declarations          */
+class UnitWorker;
+class PollScheduler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit PollScheduler(QObject *parent = nullptr);
+    ~PollScheduler();
+
+    void addWorker(UnitWorker* inputWorker);
+    void removeWorker(UnitWorker* inputWorker);
+
+    void start();
+    void stop();
+    bool isRunning();
+
+    /*          Timing Accessor Methods             */
+    int getPollInterval();
+    int getMinimumInterval();
+    int getMaximumInterval();
+    double getJitterFraction();
+
+    /*          Timing Mutator Methods              */
+    void setPollInterval(int inputInterval);                    //Milliseconds a new unit starts at
+    void setIntervalBounds(int inputMinimum, int inputMaximum);  //Limits for each unit's adaptive interval
+    void setJitterFraction(double inputFraction);              //0.1 spreads each deadline by +/-10%
+
+public slots:
+    void pollDueWorkersSlot();
+    void workerDestroyedSlot(QObject* destroyedWorker);
+    void workerIntervalShortenedSlot(UnitWorker* shortenedWorker);
+
+private:
+    QTimer* wakeTimer;
+    QElapsedTimer schedulerClock;
+
+    QMultiMap<qint64, UnitWorker*> deadlineQueue;              //Deadline -> worker, earliest first
+    QHash<UnitWorker*, qint64> workerDeadline;                //Worker -> its entry in deadlineQueue
+
+    int pollInterval;
+    int minimumInterval;
+    int maximumInterval;
+    double jitterFraction;
+    bool runningFlag;
+
+    void scheduleWorker(UnitWorker* inputWorker, qint64 deadline);
+    void unscheduleWorker(UnitWorker* inputWorker);
+    qint64 jitteredDeadline(qint64 from, int interval);
+    void armTimer();
+};
+
+#endif // POLLSCHEDULER_H
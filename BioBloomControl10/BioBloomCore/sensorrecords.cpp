@@ -0,0 +1,336 @@
+/*                  Header File                 */
+#include "sensorrecords.h"
+#include <QtEndian>
+
+#include <algorithm>
+
+static const int binaryHeaderSize = 8;                          //"BB", version, channel mask, uint32 record count
+static const int allChannelsMask = (1 << SensorRecords::ChannelCount) - 1;
+static const int timeColumn = SensorRecords::ChannelCount;      //Index of the recorded_at column
+static const int timeMask = 1 << timeColumn;                    //Same bit the hub sets in the binary header
+static const int columnCount = SensorRecords::ChannelCount + 1;
+static const int textBytesPerRecord = 24;                       //Rough size of one comma separated row, for reserving
+
+/*               Class Constructor              */
+SensorRecords::SensorRecords()
+{
+    begin(false);
+    validFlag = false;
+}
+
+
+
+/*              Parsing Methods                 */
+void SensorRecords::begin(bool inputBinaryFlag, qint64 expectedBytes, bool textTimesFlag)
+{
+    binaryFlag = inputBinaryFlag;
+    validFlag = true;
+
+    recordCount = 0;
+    channelMask = binaryFlag ? 0 : allChannelsMask | (textTimesFlag ? timeMask : 0);
+
+    for(int c = 0; c < columnCount; c++)
+    {
+        channelColumn[c].resize(0);                                             //Keeps capacity when a parser is reused
+
+        if(!binaryFlag && expectedBytes > 0)
+            channelColumn[c].reserve((int)(expectedBytes / textBytesPerRecord) + 1);
+    }
+
+    headerFill = 0;
+    channelsSent = 0;
+    expectedRecords = 0;
+    byteInValue = 0;
+    valueIndex = 0;
+
+    if(!binaryFlag)
+    {
+        if(textTimesFlag)
+            channelOrder[channelsSent++] = timeColumn;                           //Each row starts with its time
+
+        for(int c = 0; c < ChannelCount; c++)
+            channelOrder[channelsSent++] = c;
+    }
+
+    fieldValue = 0;
+    fieldScale = 1;
+    fieldNegativeFlag = false;
+    fieldFractionFlag = false;
+    fieldDigitsFlag = false;
+}
+
+bool SensorRecords::feed(const char* data, qint64 size)
+{
+    if(!validFlag || size <= 0)
+        return validFlag;
+
+    if(binaryFlag)
+        feedBinary(reinterpret_cast<const uchar*>(data), size);
+    else
+        feedText(data, size);
+
+    return validFlag;
+}
+
+bool SensorRecords::finish()
+{
+    if(!validFlag)
+        return false;
+
+    if(binaryFlag)
+    {
+        if(headerFill < binaryHeaderSize || (quint32)(valueIndex / qMax(1, channelsSent)) < expectedRecords)      //Truncated reply
+            validFlag = false;
+    }
+    else
+    {
+        endTextField();                                                         //Last value has no comma after it in recent_entry
+    }
+
+    if(!validFlag)
+        return false;
+
+    recordCount = channelsSent > 0 ? valueIndex / channelsSent : 0;
+
+    for(int c = 0; c < columnCount; c++)
+        if(channelMask & (1 << c))
+            channelColumn[c].resize(recordCount);                               //Drops a half finished text row
+
+    return true;
+}
+
+bool SensorRecords::parse(const QByteArray &data, bool inputBinaryFlag, bool textTimesFlag)
+{
+    begin(inputBinaryFlag, data.size(), textTimesFlag);
+    feed(data.constData(), data.size());
+
+    return finish();
+}
+
+void SensorRecords::append(const SensorRecords &newer)
+{
+    if(newer.recordCount == 0)
+        return;
+
+    if(recordCount == 0)
+    {
+        *this = newer;
+        return;
+    }
+
+    channelMask &= newer.channelMask;
+
+    for(int c = 0; c < columnCount; c++)
+    {
+        if(channelMask & (1 << c))
+            channelColumn[c] += newer.channelColumn[c];
+        else
+            channelColumn[c].clear();
+    }
+
+    recordCount += newer.recordCount;
+}
+
+void SensorRecords::appendRow(const double values[ChannelCount], double recordedAt)
+{
+    if(recordCount == 0)
+    {
+        channelMask = allChannelsMask | timeMask;
+
+        for(int c = 0; c < columnCount; c++)
+            channelColumn[c].resize(0);
+    }
+
+    for(int c = 0; c < ChannelCount; c++)
+        if(channelMask & (1 << c))
+            channelColumn[c].append(values[c]);
+
+    if(channelMask & timeMask)
+        channelColumn[timeColumn].append(recordedAt);
+
+    recordCount++;
+}
+
+void SensorRecords::setRecordedAt(int record, double recordedAt)
+{
+    if(record < 0 || record >= recordCount)
+        return;
+
+    if(!hasTimes())
+    {
+        channelColumn[timeColumn].fill(0, recordCount);
+        channelMask |= timeMask;
+    }
+
+    channelColumn[timeColumn][record] = recordedAt;
+}
+
+void SensorRecords::truncate(int inputCount)
+{
+    if(inputCount < 0 || inputCount >= recordCount)
+        return;
+
+    for(int c = 0; c < columnCount; c++)
+        if(channelMask & (1 << c))
+            channelColumn[c].resize(inputCount);
+
+    recordCount = inputCount;
+}
+
+void SensorRecords::feedBinary(const uchar* data, qint64 size)
+{
+    qint64 i = 0;
+
+    while(headerFill < binaryHeaderSize && i < size)
+        headerBytes[headerFill++] = data[i++];
+
+    if(headerFill < binaryHeaderSize)
+        return;
+
+    if(channelsSent == 0)                                                       //Header just completed
+    {
+        if(headerBytes[0] != 'B' || headerBytes[1] != 'B' || headerBytes[2] != 1)
+        {
+            validFlag = false;
+            return;
+        }
+
+        channelMask = headerBytes[3] & (allChannelsMask | timeMask);
+        expectedRecords = qFromLittleEndian<quint32>(headerBytes + 4);
+
+        if(channelMask & timeMask)
+            channelOrder[channelsSent++] = timeColumn;                           //Packed ahead of the channels
+
+        for(int c = 0; c < ChannelCount; c++)
+            if(channelMask & (1 << c))
+                channelOrder[channelsSent++] = c;
+
+        for(int c = 0; c < columnCount; c++)
+            if(channelMask & (1 << c))
+                channelColumn[c].reserve((int)expectedRecords);
+
+        if(!(channelMask & allChannelsMask))
+        {
+            validFlag = (expectedRecords == 0);
+            channelsSent = 1;                                                   //Nothing more to read either way
+            return;
+        }
+    }
+
+    quint64 valueLimit = (quint64)expectedRecords * channelsSent;
+
+    for(; i < size && (quint64)valueIndex < valueLimit; i++)
+    {
+        bool timeFlag = (channelOrder[valueIndex % channelsSent] == timeColumn);   //uint32 seconds, the channels are int16 tenths
+
+        valueBytes[byteInValue++] = data[i];
+
+        if(byteInValue < (timeFlag ? 4 : 2))
+            continue;
+
+        byteInValue = 0;
+
+        if(timeFlag)
+            storeValue(qFromLittleEndian<quint32>(valueBytes));
+        else
+            storeValue(qFromLittleEndian<qint16>(valueBytes));
+    }
+}
+
+void SensorRecords::feedText(const char* data, qint64 size)
+{
+    for(qint64 i = 0; i < size; i++)
+    {
+        char c = data[i];
+
+        if(c >= '0' && c <= '9')
+        {
+            if(fieldFractionFlag)
+            {
+                fieldScale /= 10;
+                fieldValue += (c - '0') * fieldScale;
+            }
+            else
+            {
+                fieldValue = fieldValue * 10 + (c - '0');
+            }
+
+            fieldDigitsFlag = true;
+        }
+        else if(c == ',')
+        {
+            endTextField();
+        }
+        else if(c == '.')
+        {
+            fieldFractionFlag = true;
+        }
+        else if(c == '-')
+        {
+            fieldNegativeFlag = true;
+        }
+        //Whitespace and anything else the hub might wrap the numbers in is skipped
+    }
+}
+
+void SensorRecords::storeValue(double inputValue)
+{
+    channelColumn[channelOrder[valueIndex % channelsSent]].append(inputValue);
+    valueIndex++;
+}
+
+void SensorRecords::endTextField()
+{
+    if(fieldDigitsFlag)                                                         //Empty fields between commas are ignored
+        storeValue(fieldNegativeFlag ? -fieldValue : fieldValue);
+
+    fieldValue = 0;
+    fieldScale = 1;
+    fieldNegativeFlag = false;
+    fieldFractionFlag = false;
+    fieldDigitsFlag = false;
+}
+
+
+
+/*              Accessor Methods                */
+int SensorRecords::count() const
+{
+    return recordCount;
+}
+
+bool SensorRecords::hasChannel(Channel channel) const
+{
+    return channelMask & (1 << channel);
+}
+
+double SensorRecords::value(int record, Channel channel) const
+{
+    if(!hasChannel(channel) || record < 0 || record >= recordCount)
+        return 0;
+
+    return channelColumn[channel][record];
+}
+
+bool SensorRecords::hasTimes() const
+{
+    return channelMask & timeMask;
+}
+
+double SensorRecords::recordedAt(int record) const
+{
+    if(!hasTimes() || record < 0 || record >= recordCount)
+        return 0;
+
+    return channelColumn[timeColumn][record];
+}
+
+int SensorRecords::firstRecordFrom(double recordedAt) const
+{
+    if(!hasTimes())
+        return 0;
+
+    const QVector<double> &times = channelColumn[timeColumn];                   //Rows arrive in data_number order, so the times rise
+
+    return std::lower_bound(times.constBegin(), times.constBegin() + recordCount, recordedAt) - times.constBegin();
+}
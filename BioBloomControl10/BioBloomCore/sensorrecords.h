@@ -0,0 +1,90 @@
+/*      Define Header File      */
+#ifndef SENSORRECORDS_H
+#define SENSORRECORDS_H
+
+/*      Library Classes         */
+#include <QByteArray>
+#include <QVector>
+
+/*
+ * Sensor rows from recent_entry, data_request or graph_data, held as one
+ * column of raw hub values (tenths) per channel. The hub sends either the old
+ * comma separated text or, when the client asked for it, packed binary
+ * records (see PeterCode/php/sensor_records.php). graph_data also sends the
+ * time each row was stored, kept in one more column as seconds since the epoch;
+ * rows are not evenly spaced, so ranges are found by time, never by row count.
+ *
+ * The parser is incremental: begin(), then feed() each chunk as the network
+ * delivers it, then finish(). Values are written straight into the columns,
+ * which are sized up front from the binary header or the expected reply
+ * length, so nothing is allocated per field. parse() does all three at once.
+ */
+
+/*          Class Declarations          */
+class SensorRecords
+{
+public:
+    enum Channel
+    {
+        LightLevel,
+        AirHumidity,
+        SoilMoisture,
+        Temperature,
+        WaterLevel,
+        BatteryLevel,
+        ChannelCount
+    };
+
+    SensorRecords();
+
+    /*          Parsing Methods                     */
+    void begin(bool binaryFlag, qint64 expectedBytes = 0, bool textTimesFlag = false);  //Text rows start with their time when textTimesFlag is set
+    bool feed(const char* data, qint64 size);                  //False once the stream is known to be malformed
+    bool finish();
+    bool parse(const QByteArray &data, bool binaryFlag, bool textTimesFlag = false);
+
+    void append(const SensorRecords &newer);                    //Adds newer rows after these, keeping the columns both have
+    void appendRow(const double values[ChannelCount], double recordedAt);       //One reading, every channel
+    void setRecordedAt(int record, double recordedAt);          //Adds the time column if the hub did not send one
+    void truncate(int inputCount);
+
+    /*          Accessor Methods                    */
+    int count() const;
+    bool hasChannel(Channel channel) const;
+    double value(int record, Channel channel) const;           //Raw tenths as stored by the hub
+
+    bool hasTimes() const;
+    double recordedAt(int record) const;                        //Seconds since the epoch, 0 when unknown
+    int firstRecordFrom(double recordedAt) const;               //First row stored at or after the time, count() if none
+
+private:
+    int recordCount;
+    int channelMask;                                            //Bit n set when channel n was sent, bit ChannelCount for the times
+    QVector<double> channelColumn[ChannelCount + 1];           //The last column holds the times
+
+    /*          Stream State                        */
+    bool binaryFlag;
+    bool validFlag;
+
+    uchar headerBytes[8];                                      //Binary: header collected across chunks
+    int headerFill;
+    int channelOrder[ChannelCount + 1];                        //Columns present, in the order they are sent
+    int channelsSent;
+    quint32 expectedRecords;
+    int byteInValue;                                           //Binary: bytes of the current value held so far
+    uchar valueBytes[4];
+    int valueIndex;                                            //Values completed so far, either format
+
+    double fieldValue;                                         //Text: number being read
+    double fieldScale;
+    bool fieldNegativeFlag;
+    bool fieldFractionFlag;
+    bool fieldDigitsFlag;
+
+    void feedBinary(const uchar* data, qint64 size);
+    void feedText(const char* data, qint64 size);
+    void storeValue(double inputValue);
+    void endTextField();
+};
+
+#endif // SENSORRECORDS_H
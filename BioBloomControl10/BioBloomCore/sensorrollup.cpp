@@ -0,0 +1,126 @@
+/*                  Header File                 */
+#include "sensorrollup.h"
+#include <algorithm>
+#include <cmath>
+
+/*               Class Constructor              */
+SensorRollup::SensorRollup(int inputBucketSeconds)
+{
+    bucketSeconds = qMax(1, inputBucketSeconds);
+    rowsCovered = 0;
+}
+
+
+
+/*              Class Methods                   */
+int SensorRollup::getBucketSeconds() const
+{
+    return bucketSeconds;
+}
+
+int SensorRollup::count() const
+{
+    return bucketRows.count();
+}
+
+double SensorRollup::startTime(int bucket) const
+{
+    return bucketStart.value(bucket);
+}
+
+int SensorRollup::firstBucketFrom(double seconds) const
+{
+    return std::upper_bound(bucketStart.constBegin(), bucketStart.constEnd(), seconds - bucketSeconds) - bucketStart.constBegin();
+}
+
+void SensorRollup::sync(const SensorRecords &records, int firstChangedRow)
+{
+    //Buckets holding replaced rows are dropped and rebuilt from the start of the first of them;
+    //plain appends carry on filling the partial last bucket
+    if(firstChangedRow < rowsCovered)
+    {
+        int keptBuckets = std::upper_bound(bucketFirstRow.constBegin(), bucketFirstRow.constEnd(), qMax(0, firstChangedRow)) - bucketFirstRow.constBegin() - 1;
+        keptBuckets = qMax(0, keptBuckets);                                     //Index of the bucket holding firstChangedRow
+
+        rowsCovered = bucketFirstRow.value(keptBuckets);
+
+        for(int c = 0; c < SensorRecords::ChannelCount; c++)
+        {
+            minimumColumn[c].resize(keptBuckets);
+            maximumColumn[c].resize(keptBuckets);
+            sumColumn[c].resize(keptBuckets);
+        }
+
+        bucketStart.resize(keptBuckets);
+        bucketFirstRow.resize(keptBuckets);
+        bucketRows.resize(keptBuckets);
+    }
+
+    for(int row = rowsCovered; row < records.count(); row++)
+    {
+        double start = std::floor(records.recordedAt(row) / bucketSeconds) * bucketSeconds;
+        bool newBucketFlag = (bucketStart.isEmpty() || start > bucketStart.last());
+
+        if(newBucketFlag)
+        {
+            bucketStart.append(start);
+            bucketFirstRow.append(row);
+            bucketRows.append(0);
+        }
+
+        int bucket = bucketRows.count() - 1;
+
+        for(int c = 0; c < SensorRecords::ChannelCount; c++)
+        {
+            double value = records.value(row, (SensorRecords::Channel)c);
+
+            if(newBucketFlag)
+            {
+                minimumColumn[c].append(value);
+                maximumColumn[c].append(value);
+                sumColumn[c].append(value);
+                continue;
+            }
+
+            minimumColumn[c][bucket] = qMin(minimumColumn[c][bucket], value);
+            maximumColumn[c][bucket] = qMax(maximumColumn[c][bucket], value);
+            sumColumn[c][bucket] += value;
+        }
+
+        bucketRows[bucket]++;
+    }
+
+    rowsCovered = records.count();
+}
+
+void SensorRollup::clear()
+{
+    for(int c = 0; c < SensorRecords::ChannelCount; c++)
+    {
+        minimumColumn[c].clear();
+        maximumColumn[c].clear();
+        sumColumn[c].clear();
+    }
+
+    bucketStart.clear();
+    bucketFirstRow.clear();
+    bucketRows.clear();
+    rowsCovered = 0;
+}
+
+double SensorRollup::minimum(int bucket, SensorRecords::Channel channel) const
+{
+    return minimumColumn[channel].value(bucket);
+}
+
+double SensorRollup::maximum(int bucket, SensorRecords::Channel channel) const
+{
+    return maximumColumn[channel].value(bucket);
+}
+
+double SensorRollup::mean(int bucket, SensorRecords::Channel channel) const
+{
+    int rows = bucketRows.value(bucket);
+
+    return rows > 0 ? sumColumn[channel][bucket] / rows : 0;
+}
@@ -0,0 +1,50 @@
+/*      Define Header File      */
+#ifndef SENSORROLLUP_H
+#define SENSORROLLUP_H
+
+/*      Library Classes         */
+#include <QVector>
+
+#include "sensorrecords.h"
+
+/*
+ * Minimum, mean and maximum of every channel over fixed spans of time, found
+ * from each row's recorded time. Pots report every 15 to 600 seconds, so a
+ * bucket holds however many rows fell inside it and spans with no rows have
+ * no bucket. sync() only touches the buckets from the first changed row
+ * onwards, so keeping a rollup next to a growing history costs the same as
+ * the rows added. A row stamped before the last bucket is folded into it.
+ */
+
+/*          Class Declarations          */
+class SensorRollup
+{
+public:
+    explicit SensorRollup(int inputBucketSeconds = 600);
+
+    int getBucketSeconds() const;
+    int count() const;                                          //Buckets, including a partial last one
+    double startTime(int bucket) const;                         //Seconds since the epoch
+    int firstBucketFrom(double seconds) const;                  //First bucket ending after the time, count() if none
+
+    void sync(const SensorRecords &records, int firstChangedRow);       //Rows from firstChangedRow on are new or replaced
+    void clear();
+
+    double minimum(int bucket, SensorRecords::Channel channel) const;
+    double maximum(int bucket, SensorRecords::Channel channel) const;
+    double mean(int bucket, SensorRecords::Channel channel) const;
+
+private:
+    int bucketSeconds;
+    int rowsCovered;
+
+    QVector<double> bucketStart;
+    QVector<int> bucketFirstRow;
+
+    QVector<double> minimumColumn[SensorRecords::ChannelCount];
+    QVector<double> maximumColumn[SensorRecords::ChannelCount];
+    QVector<double> sumColumn[SensorRecords::ChannelCount];
+    QVector<int> bucketRows;                                   //Rows in each bucket so far
+};
+
+#endif // SENSORROLLUP_H
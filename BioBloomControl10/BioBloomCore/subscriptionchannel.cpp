@@ -0,0 +1,194 @@
+/*                  Header File                 */
+#include "subscriptionchannel.h"
+#include "hubfieldreader.h"
+#include <QStringList>
+#include <QDebug>
+
+static const int firstRetryDelay = 2000;                   //Milliseconds before the first retry after a failure
+static const int maximumRetryDelay = 30000;               //Retries back off to at most this
+
+/*          Constructor and Destructor          */
+SubscriptionChannel::SubscriptionChannel(QObject *parent) : QObject(parent)
+{
+    pendingReplyAddress = NULL;
+
+    resubscribeTimer = new QTimer(this);
+    resubscribeTimer->setSingleShot(true);
+
+    retryDelay = firstRetryDelay;
+    runningFlag = false;
+    connectedFlag = false;
+
+    connect(resubscribeTimer, SIGNAL(timeout()), this, SLOT(resubscribeSlot()));
+}
+
+SubscriptionChannel::~SubscriptionChannel()
+{
+    stop();
+}
+
+
+
+/*              Class Methods                   */
+void SubscriptionChannel::subscribeUnit(BioBloomUnit* inputUnit)
+{
+    QString mac = inputUnit->getMacAddress();
+
+    if(subscribedUnits.value(mac) == inputUnit)
+        return;
+
+    subscribedUnits.insert(mac, inputUnit);
+
+    connect(inputUnit, SIGNAL(destroyed(QObject*)), this, SLOT(unitDestroyedSlot(QObject*)));
+
+    if(runningFlag)
+        scheduleResubscribe(0);                                             //Units added in one burst share a single restart
+}
+
+void SubscriptionChannel::start()
+{
+    runningFlag = true;
+    retryDelay = firstRetryDelay;
+    scheduleResubscribe(0);
+}
+
+void SubscriptionChannel::stop()
+{
+    runningFlag = false;
+    resubscribeTimer->stop();
+
+    if(pendingReplyAddress)
+    {
+        HubReply* reply = pendingReplyAddress;
+        pendingReplyAddress = NULL;
+        disconnect(reply, SIGNAL(finished(HubReply*)), this, SLOT(subscriptionFinished(HubReply*)));
+        reply->abort();
+    }
+
+    if(connectedFlag)
+    {
+        connectedFlag = false;
+        emit channelDown();
+    }
+}
+
+bool SubscriptionChannel::isConnected()
+{
+    return connectedFlag;
+}
+
+void SubscriptionChannel::openSubscription()
+{
+    if(!runningFlag || pendingReplyAddress || subscribedUnits.isEmpty())
+        return;
+
+    QStringList macs;
+    QStringList since;
+
+    QHash<QString, BioBloomUnit*>::const_iterator i;
+    for(i = subscribedUnits.constBegin(); i != subscribedUnits.constEnd(); ++i)
+    {
+        macs.append(i.key());
+        since.append(QString::number(i.value()->getLastDataNumber()));     //Rows from any path count, a unit with none gets its newest straight away
+    }
+
+    pendingReplyAddress = HubClient::instance()->subscribe(macs, since);
+    connect(pendingReplyAddress, SIGNAL(finished(HubReply*)),
+            this, SLOT(subscriptionFinished(HubReply*)));
+}
+
+void SubscriptionChannel::scheduleResubscribe(int delay)
+{
+    if(delay == 0 && pendingReplyAddress)
+    {
+        //The open poll does not cover the new unit; drop it and ask again with the full list
+        HubReply* reply = pendingReplyAddress;
+        pendingReplyAddress = NULL;
+        disconnect(reply, SIGNAL(finished(HubReply*)), this, SLOT(subscriptionFinished(HubReply*)));
+        reply->abort();
+    }
+
+    if(resubscribeTimer->isActive() && resubscribeTimer->remainingTime() <= delay)
+        return;
+
+    resubscribeTimer->start(delay);
+}
+
+
+
+/*              Class Slots                     */
+void SubscriptionChannel::subscriptionFinished(HubReply* reply)
+{
+    if(reply != pendingReplyAddress)
+        return;
+
+    pendingReplyAddress = NULL;
+
+    if(reply->isError())
+    {
+        qCDebug(hubLog) << "Subscription failed:" << reply->errorString();
+
+        if(connectedFlag)
+        {
+            connectedFlag = false;
+            emit channelDown();
+        }
+
+        scheduleResubscribe(retryDelay);
+        retryDelay = qMin(retryDelay * 2, maximumRetryDelay);
+        return;
+    }
+
+    retryDelay = firstRetryDelay;
+
+    if(!connectedFlag)
+    {
+        connectedFlag = true;
+        emit channelUp();
+    }
+
+    HubFieldReader fields(reply->data());
+    QLatin1String mac;
+    QLatin1String value[7];
+
+    //mac, data_number, light, humidity, moisture, temperature, water level, battery level per new row
+    while(fields.next(mac))
+    {
+        int filled = 0;
+        while(filled < 7 && fields.next(value[filled]))
+            filled++;
+
+        if(filled < 7)
+            break;
+
+        QHash<QString, BioBloomUnit*>::const_iterator unit = subscribedUnits.constFind(mac);
+
+        if(unit == subscribedUnits.constEnd())
+            continue;
+
+        unit.value()->receiveSensorRow((int)HubFieldReader::toNumber(value[0]),                      //Ignored if another path already delivered it
+                                       HubFieldReader::toNumber(value[1]),
+                                       HubFieldReader::toNumber(value[2]),
+                                       HubFieldReader::toNumber(value[3]),
+                                       HubFieldReader::toNumber(value[4]),
+                                       HubFieldReader::toNumber(value[5]),
+                                       HubFieldReader::toNumber(value[6]));
+    }
+
+    openSubscription();                                                     //Re-arm straight away, empty replies just mean the hub timed the poll out
+}
+
+void SubscriptionChannel::resubscribeSlot()
+{
+    openSubscription();
+}
+
+void SubscriptionChannel::unitDestroyedSlot(QObject* destroyedUnit)
+{
+    QString mac = subscribedUnits.key(static_cast<BioBloomUnit*>(destroyedUnit));      //Only compared, never dereferenced
+
+    if(mac.isEmpty())
+        return;
+
+    subscribedUnits.remove(mac);
+}
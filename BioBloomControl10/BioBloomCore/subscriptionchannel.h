@@ -0,0 +1,64 @@
+/*      Define Header File      */
+#ifndef SUBSCRIPTIONCHANNEL_H
+#define SUBSCRIPTIONCHANNEL_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QTimer>
+#include <QHash>
+#include <QString>
+
+#include "hubclient.h"
+#include "biobloomunit.h"
+
+/*
+ * Keeps one long poll open to the hub's subscribe.php for every subscribed
+ * unit. The hub holds the request until one of those pots gets a newer
+ * sensor row, answers with just the new rows, and the channel re-arms at
+ * once, so readings reach their BioBloomUnit moments after they are stored.
+ * The cursor sent for each pot is the newest row its unit holds, whether it
+ * came through this channel, a data request or a fleet snapshot.
+ * A failed request is retried with a growing delay; channelDown() tells the
+ * owner to fall back to polling until channelUp() comes back.
+ */
+
+/*          Class Declarations          */
+class BioBloomUnit;
+class SubscriptionChannel : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit SubscriptionChannel(QObject *parent = nullptr);
+    ~SubscriptionChannel();
+
+    void subscribeUnit(BioBloomUnit* inputUnit);
+
+    void start();
+    void stop();
+    bool isConnected();
+
+signals:
+    void channelUp();
+    void channelDown();
+
+public slots:
+    void subscriptionFinished(HubReply* reply);
+    void resubscribeSlot();
+    void unitDestroyedSlot(QObject* destroyedUnit);
+
+private:
+    QHash<QString, BioBloomUnit*> subscribedUnits;      //MAC -> unit the pushed rows are delivered to
+
+    HubReply* pendingReplyAddress;                      //The long poll currently held open, if any
+    QTimer* resubscribeTimer;                          //Coalesces restarts and spaces out retries
+
+    int retryDelay;
+    bool runningFlag;
+    bool connectedFlag;
+
+    void openSubscription();
+    void scheduleResubscribe(int delay);
+};
+
+#endif // SUBSCRIPTIONCHANNEL_H
@@ -0,0 +1,166 @@
+/*                  Header File                 */
+#include "tracerecorder.h"
+#include <QSettings>
+#include <QThread>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QCoreApplication>
+#include <QDebug>
+
+static const int maximumEvents = 1000000;                                       //About a day of a busy fleet, then recording stops
+
+/*               Class Constructor              */
+TraceRecorder::TraceRecorder()
+{
+    traceClock.start();
+
+    QSettings settings;
+    traceFile = qEnvironmentVariable("BIOBLOOM_TRACE_FILE", settings.value("diagnostics/traceFile").toString());
+    enabledFlag = !traceFile.isEmpty();
+
+    if(enabledFlag)
+        events.reserve(4096);
+}
+
+TraceRecorder* TraceRecorder::instance()
+{
+    static TraceRecorder recorder;
+
+    return &recorder;
+}
+
+
+
+/*              Class Methods                   */
+bool TraceRecorder::isEnabled()
+{
+    return enabledFlag;
+}
+
+qint64 TraceRecorder::now()
+{
+    return traceClock.nsecsElapsed() / 1000;
+}
+
+void TraceRecorder::complete(const char* name, const char* category, qint64 start, const QString& unit)
+{
+    if(enabledFlag)
+        append('X', name, category, start, now() - start, nullptr, unit);
+}
+
+void TraceRecorder::asyncBegin(const char* name, const char* category, const void* id, const QString& unit)
+{
+    if(enabledFlag)
+        append('b', name, category, now(), 0, id, unit);
+}
+
+void TraceRecorder::asyncEnd(const char* name, const char* category, const void* id, const QString& detail)
+{
+    if(enabledFlag)
+        append('e', name, category, now(), 0, id, detail);
+}
+
+void TraceRecorder::instant(const char* name, const char* category, const QString& unit)
+{
+    if(enabledFlag)
+        append('i', name, category, now(), 0, nullptr, unit);
+}
+
+void TraceRecorder::append(char phase, const char* name, const char* category, qint64 timestamp, qint64 duration,
+                           const void* id, const QString& detail)
+{
+    QMutexLocker locker(&eventMutex);
+
+    if(events.count() >= maximumEvents)
+        return;
+
+    TraceEvent event;
+    event.phase = phase;
+    event.name = name;
+    event.category = category;
+    event.timestamp = timestamp;
+    event.duration = duration;
+    event.id = (quintptr)id;
+    event.threadId = (quintptr)QThread::currentThreadId();
+    event.detail = detail;
+
+    events.append(event);
+}
+
+bool TraceRecorder::write()
+{
+    if(!enabledFlag)
+        return false;
+
+    QMutexLocker locker(&eventMutex);
+
+    QJsonArray traceEvents;
+    qint64 processId = QCoreApplication::applicationPid();
+
+    for(int i = 0; i < events.count(); i++)
+    {
+        const TraceEvent &event = events[i];
+
+        QJsonObject output;
+        output.insert("name", QLatin1String(event.name));
+        output.insert("cat", QLatin1String(event.category));
+        output.insert("ph", QString(QChar(event.phase)));
+        output.insert("ts", (double)event.timestamp);
+        output.insert("pid", (double)processId);
+        output.insert("tid", (double)event.threadId);
+
+        if(event.phase == 'X')
+            output.insert("dur", (double)event.duration);
+
+        if(event.phase == 'b' || event.phase == 'e')
+            output.insert("id", QString::number(event.id, 16));                 //Hex string, ids are pointers
+
+        if(event.phase == 'i')
+            output.insert("s", QString("t"));
+
+        if(!event.detail.isEmpty())
+        {
+            QJsonObject args;
+            args.insert(event.phase == 'e' ? "result" : "unit", event.detail);
+            output.insert("args", args);
+        }
+
+        traceEvents.append(output);
+    }
+
+    QJsonObject document;
+    document.insert("traceEvents", traceEvents);
+    document.insert("displayTimeUnit", QString("ms"));
+
+    QFile outputFile(traceFile);
+
+    if(!outputFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qDebug() << "Trace could not be written to" << traceFile;
+        return false;
+    }
+
+    outputFile.write(QJsonDocument(document).toJson(QJsonDocument::Compact));
+
+    return true;
+}
+
+
+
+/*              Span Methods                    */
+TraceSpan::TraceSpan(const char* inputName, const char* inputCategory, const QString& inputUnit) : name(inputName),
+                                                                                                  category(inputCategory),
+                                                                                                  unit(inputUnit),
+                                                                                                  start(-1)
+{
+    if(TraceRecorder::instance()->isEnabled())
+        start = TraceRecorder::instance()->now();
+}
+
+TraceSpan::~TraceSpan()
+{
+    if(start >= 0)
+        TraceRecorder::instance()->complete(name, category, start, unit);
+}
@@ -0,0 +1,77 @@
+/*      Define Header File      */
+#ifndef TRACERECORDER_H
+#define TRACERECORDER_H
+
+/*      Library Classes         */
+#include <QString>
+#include <QVector>
+#include <QMutex>
+#include <QElapsedTimer>
+
+/*
+ * Opt-in timeline of what the client spends its time on, written as Chrome
+ * trace-event JSON (load it in chrome://tracing or Perfetto). Off unless the
+ * diagnostics/traceFile setting or the BIOBLOOM_TRACE_FILE environment variable
+ * names a file; while off every call returns straight away. Hub requests are
+ * async spans keyed by the reply so overlapping requests get their own rows,
+ * everything else is a TraceSpan on the thread that ran it. Each event can be
+ * tagged with the pot it concerns. write() is called once the event loop ends.
+ */
+
+/*          Class Declarations          */
+class TraceRecorder
+{
+
+public:
+    static TraceRecorder* instance();                           //Created on first use, call early so timestamps start at launch
+
+    bool isEnabled();
+    bool write();                                               //Writes the trace file, false if off or it could not be written
+
+    qint64 now();                                               //Microseconds since the recorder started
+
+    void complete(const char* name, const char* category, qint64 start, const QString& unit = QString());
+    void asyncBegin(const char* name, const char* category, const void* id, const QString& unit = QString());
+    void asyncEnd(const char* name, const char* category, const void* id, const QString& detail = QString());
+    void instant(const char* name, const char* category, const QString& unit = QString());
+
+private:
+    TraceRecorder();
+
+    struct TraceEvent
+    {
+        char phase;                                             //X complete, b/e async begin and end, i instant
+        const char* name;                                       //String literals only, never freed
+        const char* category;
+        qint64 timestamp;
+        qint64 duration;
+        quintptr id;
+        quintptr threadId;
+        QString detail;                                         //Unit MAC, or how an async span ended
+    };
+
+    bool enabledFlag;
+    QString traceFile;
+    QElapsedTimer traceClock;
+    QMutex eventMutex;
+    QVector<TraceEvent> events;
+
+    void append(char phase, const char* name, const char* category, qint64 timestamp, qint64 duration,
+                const void* id, const QString& detail);
+};
+
+class TraceSpan
+{
+
+public:
+    TraceSpan(const char* inputName, const char* inputCategory, const QString& inputUnit = QString());
+    ~TraceSpan();
+
+private:
+    const char* name;
+    const char* category;
+    QString unit;
+    qint64 start;                                               //-1 while tracing is off
+};
+
+#endif // TRACERECORDER_H
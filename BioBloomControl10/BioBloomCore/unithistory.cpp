@@ -0,0 +1,150 @@
+/*                  Header File                 */
+#include "unithistory.h"
+#include "tracerecorder.h"
+#include <QDateTime>
+
+static const int assumedRowSpacing = 60;                        //Seconds between rows the hub stored without a time
+
+/*               Class Constructor              */
+UnitHistory::UnitHistory(QObject *parent) : QObject(parent)
+{
+    rollupLevel[TenMinutes] = SensorRollup(10 * 60);                            //Bucket lengths in seconds
+    rollupLevel[OneHour] = SensorRollup(60 * 60);
+    rollupLevel[OneDay] = SensorRollup(24 * 60 * 60);
+
+    confirmedCount = 0;
+    lastDataNumber = 0;
+
+    loadedFlag = 0;
+    fetchPendingFlag = 0;
+}
+
+
+
+/*              Class Methods                   */
+void UnitHistory::setMacAddress(QString inputMacAddress)
+{
+    if(inputMacAddress == macAddress)
+        return;
+
+    macAddress = inputMacAddress;
+
+    history = SensorRecords();                                                  //A different pot's rows are of no use
+    syncRollups(0);
+    confirmedCount = 0;
+    lastDataNumber = 0;
+    loadedFlag = 0;
+}
+
+QString UnitHistory::getMacAddress()
+{
+    return macAddress;
+}
+
+const SensorRecords &UnitHistory::records()
+{
+    return history;
+}
+
+const SensorRollup &UnitHistory::rollup(RollupLevel level)
+{
+    return rollupLevel[level];
+}
+
+void UnitHistory::syncRollups(int firstChangedRow)
+{
+    for(int i = 0; i < RollupLevelCount; i++)
+        rollupLevel[i].sync(history, firstChangedRow);
+}
+
+void UnitHistory::fillMissingTimes(SensorRecords &rows)
+{
+    double nextTime = QDateTime::currentSecsSinceEpoch();
+
+    for(int i = rows.count() - 1; i >= 0; i--)                                  //Newest first, each gap is measured from the row after it
+    {
+        double time = rows.recordedAt(i);
+
+        if(time <= 0)
+        {
+            time = nextTime - assumedRowSpacing;
+            rows.setRecordedAt(i, time);
+        }
+
+        nextTime = time;
+    }
+}
+
+bool UnitHistory::isLoaded()
+{
+    return loadedFlag;
+}
+
+void UnitHistory::refresh()
+{
+    if(fetchPendingFlag || macAddress.isEmpty())                                //Every caller is answered by the fetch already out
+        return;
+
+    fetchPendingFlag = 1;
+
+    HubReply* reply = HubClient::instance()->graphData(macAddress, lastDataNumber);
+    connect(reply, SIGNAL(finished(HubReply*)),
+            this, SLOT(graphDataFinished(HubReply*)));
+}
+
+void UnitHistory::appendReading(double light_level, double air_humidity, double soil_moisture,
+                                double temperature, double water_level, double battery_level)
+{
+    if(!loadedFlag)                                                             //The first fetch will bring this row anyway
+        return;
+
+    double row[SensorRecords::ChannelCount] = {light_level, air_humidity, soil_moisture,
+                                               temperature, water_level, battery_level};
+
+    history.appendRow(row, QDateTime::currentSecsSinceEpoch());
+    syncRollups(history.count() - 1);
+
+    emit historyChanged();
+}
+
+
+
+/*              Class Slots                     */
+void UnitHistory::graphDataFinished(HubReply* reply)
+{
+    TraceSpan span("history merge", "parse", macAddress);
+
+    fetchPendingFlag = 0;
+
+    SensorRecords newRows;
+
+    if(!reply->readRecords(newRows))
+    {
+        emit historyChanged();                                                  //Graphs still show what is held
+        return;
+    }
+
+    fillMissingTimes(newRows);
+
+    int firstChangedRow = confirmedCount;
+
+    if(reply->getLastDataNumber() < 0)                                          //Hub ignored the cursor and sent everything
+    {
+        history = newRows;
+        lastDataNumber = 0;
+        firstChangedRow = 0;
+    }
+    else
+    {
+        history.truncate(confirmedCount);                                       //Live rows are about to arrive properly
+        history.append(newRows);
+        lastDataNumber = reply->getLastDataNumber();
+    }
+
+    syncRollups(firstChangedRow);
+
+    confirmedCount = history.count();
+    loadedFlag = 1;
+
+    emit historyChanged();
+}
@@ -0,0 +1,76 @@
+/*      Define Header File      */
+#ifndef UNITHISTORY_H
+#define UNITHISTORY_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QString>
+
+#include "hubclient.h"
+#include "sensorrecords.h"
+#include "sensorrollup.h"
+
+/*
+ * One unit's sensor history, every channel, held once in columns and shared
+ * by all of that unit's graphs. refresh() fetches only the rows after the
+ * newest data_number already held; graphs opened while a fetch is on its way
+ * wait for that same fetch. Readings that arrive between fetches are added
+ * at the end straight away and replaced by the hub's own rows on the next
+ * refresh, so nothing is counted twice.
+ *
+ * Ten minute, hourly and daily rollups are kept up to date alongside the raw
+ * rows so long chart ranges can be drawn from a few hundred buckets. Every row
+ * carries the time the hub stored it; readings appended live are stamped on
+ * arrival, and rows stored before the hub kept times are spaced a minute
+ * apart back from the next row that has one.
+ */
+
+/*          Class Declarations          */
+class UnitHistory : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit UnitHistory(QObject *parent = nullptr);
+
+    void setMacAddress(QString inputMacAddress);
+    QString getMacAddress();
+
+    enum RollupLevel
+    {
+        TenMinutes,
+        OneHour,
+        OneDay,
+        RollupLevelCount
+    };
+
+    const SensorRecords &records();
+    const SensorRollup &rollup(RollupLevel level);
+    bool isLoaded();                                            //At least one fetch has completed
+
+    void refresh();
+    void appendReading(double light_level, double air_humidity, double soil_moisture,
+                       double temperature, double water_level, double battery_level);     //Raw hub values, in tenths
+
+signals:
+    void historyChanged();
+
+public slots:
+    void graphDataFinished(HubReply* reply);
+
+private:
+    QString macAddress;
+
+    SensorRecords history;
+    SensorRollup rollupLevel[RollupLevelCount];
+    int confirmedCount;                                        //Rows that came from graph_data, the rest were appended live
+    int lastDataNumber;                                        //Cursor for the next fetch
+
+    bool loadedFlag;
+    bool fetchPendingFlag;
+
+    void syncRollups(int firstChangedRow);
+    static void fillMissingTimes(SensorRecords &rows);
+};
+
+#endif // UNITHISTORY_H
@@ -0,0 +1,104 @@
+#include "unitworker.h"
+#include <QDebug>
+#include <QLoggingCategory>
+
+Q_LOGGING_CATEGORY(pollLog, "biobloom.poll", QtWarningMsg)                         //QT_LOGGING_RULES="biobloom.poll.debug=true" to follow each unit's interval
+
+/*
+ * How fast each channel has to move, per minute, before the unit counts as busy.
+ * A unit moving at these rates is polled at the minimum interval; one moving at
+ * under a quarter of them backs off towards the maximum.
+ */
+static const double moistureChangePerMinute = 1.0;         //% soil moisture
+static const double tempChangePerMinute = 0.5;            //degrees celsius
+static const double lightChangePerMinute = 5.0;          //% light level
+
+UnitWorker::UnitWorker(BioBloomUnit* inputParentUnit, QObject *parent) : QObject(parent), parentUnitAddress(inputParentUnit)
+{
+    pollInterval = 60000;
+    minimumInterval = 15000;
+    maximumInterval = 600000;
+
+    previousReadingFlag = 0;
+
+    connect(parentUnitAddress, SIGNAL(newRowReceived(int)), this, SLOT(readingReceivedSlot()));          //Repeats of a row would read as a flat pot
+    connect(parentUnitAddress, SIGNAL(plantWatered()), this, SLOT(plantWateredSlot()));
+}
+
+UnitWorker::~UnitWorker()
+{}
+
+/*              Class Slots             */
+void UnitWorker::poll()
+{
+    potDataRequest();
+
+    qCDebug(pollLog) << "worker poll" << parentUnitAddress->getUnitNumber() << pollInterval;
+}
+
+void UnitWorker::readingReceivedSlot()
+{
+    double moisture = parentUnitAddress->getCurrentMoisture();
+    double temp = parentUnitAddress->getCurrentTemp();
+    double light = parentUnitAddress->getCurrentLight();
+
+    if(previousReadingFlag && previousReadingTimer.elapsed() > 0)
+    {
+        double minutes = qMax(previousReadingTimer.elapsed() / 60000.0, 0.25);     //Readings close together should not look like huge swings
+
+        //Activity is the fastest channel's rate relative to its threshold
+        double activity = qAbs(moisture - previousMoisture) / minutes / moistureChangePerMinute;
+        activity = qMax(activity, qAbs(temp - previousTemp) / minutes / tempChangePerMinute);
+        activity = qMax(activity, qAbs(light - previousLight) / minutes / lightChangePerMinute);
+
+        if(activity >= 1.0)
+            tightenInterval(minimumInterval);
+
+        else if(activity >= 0.5)
+            tightenInterval(pollInterval / 2);
+
+        else if(activity < 0.25)
+            pollInterval = qMin(pollInterval * 2, maximumInterval);                 //Flat readings back off
+    }
+
+    previousMoisture = moisture;
+    previousTemp = temp;
+    previousLight = light;
+    previousReadingFlag = 1;
+    previousReadingTimer.start();
+}
+
+void UnitWorker::plantWateredSlot()
+{
+    tightenInterval(minimumInterval);                                                //Moisture is about to move, watch it closely
+}
+
+/*              Class Methods              */
+void UnitWorker::potDataRequest()
+{
+    emit dataRequestSignal();                   //The unit updates itself as soon as the hub has the new row
+}
+
+int UnitWorker::getPollInterval()
+{
+    return pollInterval;
+}
+
+void UnitWorker::setIntervalBounds(int inputMinimum, int inputMaximum, int inputStart)
+{
+    minimumInterval = inputMinimum;
+    maximumInterval = qMax(inputMinimum, inputMaximum);
+    pollInterval = qBound(minimumInterval, inputStart, maximumInterval);
+}
+
+void UnitWorker::tightenInterval(int newInterval)
+{
+    newInterval = qMax(newInterval, minimumInterval);
+
+    if(newInterval >= pollInterval)
+        return;
+
+    pollInterval = newInterval;
+
+    emit pollIntervalShortened(this);
+}
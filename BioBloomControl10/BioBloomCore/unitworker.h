@@ -0,0 +1,52 @@
+#ifndef UNITWORKER_H
+#define UNITWORKER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+
+#include "biobloomunit.h"
+
+class BioBloomUnit;
+class UnitWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit UnitWorker(BioBloomUnit* inputParentUnit, QObject *parent = nullptr);
+    ~UnitWorker();
+    
+    
+    void potDataRequest();
+
+    /*          Adaptive Interval Methods           */
+    int getPollInterval();
+    void setIntervalBounds(int inputMinimum, int inputMaximum, int inputStart);   //Milliseconds
+
+signals:
+    void dataRequestSignal();                //Asks the unit to poke its pot for a new reading
+    void pollIntervalShortened(UnitWorker* worker);      //Lets the scheduler pull the next poll forward
+
+public slots:
+    void poll();                             //Called by the PollScheduler when this unit is due
+    void readingReceivedSlot();
+    void plantWateredSlot();
+
+private:
+    BioBloomUnit* parentUnitAddress;
+
+    /*          Adaptive Interval Objects           */
+    int pollInterval;
+    int minimumInterval;
+    int maximumInterval;
+
+    bool previousReadingFlag;
+    double previousMoisture;
+    double previousTemp;
+    double previousLight;
+    QElapsedTimer previousReadingTimer;
+
+    void tightenInterval(int newInterval);
+
+};
+
+#endif // UNITWORKER_H
@@ -0,0 +1,25 @@
+#-------------------------------------------------
+#
+# BioBloomCore's polling and control engine with no user interface,
+# for running on the hub as a low footprint fleet supervisor
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = BioBloomHeadless
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../BioBloomCore/BioBloomCore.pri)
+
+SOURCES += \
+        main.cpp \
+    headlesssupervisor.cpp \
+
+HEADERS += \
+    headlesssupervisor.h \
@@ -0,0 +1,74 @@
+/*                  Header File                 */
+#include "headlesssupervisor.h"
+#include "metricsregistry.h"
+#include <QDebug>
+
+/*               Class Constructor              */
+HeadlessSupervisor::HeadlessSupervisor(QObject *parent) : QObject(parent)
+{
+    fleetControllerAddress = new FleetController(this);
+    statusTimer = new QTimer(this);
+    statusTimer->setTimerType(Qt::VeryCoarseTimer);
+
+    connect(fleetControllerAddress, SIGNAL(unitsLoaded()), this, SLOT(unitsLoadedSlot()));
+    connect(statusTimer, SIGNAL(timeout()), this, SLOT(statusSlot()));
+}
+
+
+
+/*              Class Methods                   */
+void HeadlessSupervisor::start(int inputStatusInterval)
+{
+    fleetControllerAddress->start();
+
+    if(inputStatusInterval > 0)
+        statusTimer->start(inputStatusInterval);
+}
+
+void HeadlessSupervisor::stop()
+{
+    statusTimer->stop();
+    fleetControllerAddress->stop();
+}
+
+FleetController* HeadlessSupervisor::getFleetController()
+{
+    return fleetControllerAddress;
+}
+
+
+
+/*              Class Slots                     */
+void HeadlessSupervisor::statusSlot()
+{
+    int lowWater = 0;
+    int lowBattery = 0;
+    int silent = 0;                                                         //No reading yet
+
+    for(int i = 0; i < fleetControllerAddress->getUnitCount(); i++)
+    {
+        BioBloomUnit* unit = fleetControllerAddress->unitAt(i);
+
+        if(!unit->readingReceivedFlag)
+            silent++;
+        else
+        {
+            lowWater += unit->waterLevelLowFlag ? 1 : 0;
+            lowBattery += unit->batteryLevelLowFlag ? 1 : 0;
+        }
+    }
+
+    qInfo().noquote() << QString("units %1, readings %2, silent %3, low water %4, low battery %5, in flight %6, queued %7")
+                         .arg(fleetControllerAddress->getUnitCount())
+                         .arg(MetricsRegistry::instance()->counter("units.readings"))
+                         .arg(silent)
+                         .arg(lowWater)
+                         .arg(lowBattery)
+                         .arg(HubClient::instance()->getInFlightCount())
+                         .arg(HubClient::instance()->getQueuedCount());
+}
+
+void HeadlessSupervisor::unitsLoadedSlot()
+{
+    qInfo() << "Supervising" << fleetControllerAddress->getUnitCount() << "pots";
+}
@@ -0,0 +1,40 @@
+/*      Define Header File      */
+#ifndef HEADLESSSUPERVISOR_H
+#define HEADLESSSUPERVISOR_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QTimer>
+
+#include "fleetcontroller.h"
+
+/*
+ * Runs a FleetController with nothing on screen and logs a one line summary
+ * of the fleet every so often: how many pots are loaded, how many readings
+ * have come in, how many pots are low on water or battery, and how busy the
+ * hub connection is.
+ */
+
+/*          Class Declarations          */
+class HeadlessSupervisor : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit HeadlessSupervisor(QObject *parent = nullptr);
+
+    void start(int inputStatusInterval);                        //Milliseconds between summaries, 0 for none
+    void stop();
+
+    FleetController* getFleetController();
+
+public slots:
+    void statusSlot();
+    void unitsLoadedSlot();
+
+private:
+    FleetController* fleetControllerAddress;
+    QTimer* statusTimer;
+};
+
+#endif // HEADLESSSUPERVISOR_H
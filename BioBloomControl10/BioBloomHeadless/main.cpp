@@ -0,0 +1,54 @@
+#include "headlesssupervisor.h"
+#include "hubclient.h"
+#include "metricsregistry.h"
+#include "tracerecorder.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QSettings>
+#include <QTimer>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    a.setOrganizationName("BioBloom");                  //Same QSettings store as the app
+    a.setApplicationName("BioBloomControl");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Polls and looks after a BioBloom fleet without a window");
+    parser.addHelpOption();
+
+    QCommandLineOption hubOption("hub-url", "Hub to talk to instead of hub/url.", "url");
+    QCommandLineOption statusOption("status", "Seconds between fleet summaries, 0 for none.", "seconds", "60");
+    QCommandLineOption runOption("run-for", "Seconds to run before exiting, 0 to run until killed.", "seconds", "0");
+    parser.addOption(hubOption);
+    parser.addOption(statusOption);
+    parser.addOption(runOption);
+    parser.process(a);
+
+    if(parser.isSet(hubOption))
+        HubClient::instance()->setHubUrl(QUrl::fromUserInput(parser.value(hubOption)));
+
+    TraceRecorder* trace = TraceRecorder::instance();
+
+    HeadlessSupervisor supervisor;
+    supervisor.start(parser.value(statusOption).toInt() * 1000);
+
+    int runFor = parser.value(runOption).toInt();
+
+    if(runFor > 0)
+        QTimer::singleShot(runFor * 1000, &a, SLOT(quit()));               //Metrics and trace are only written on a clean exit
+
+    int exitCode = a.exec();
+
+    supervisor.stop();
+
+    QSettings settings;
+    QString metricsFile = settings.value("diagnostics/metricsFile").toString();
+
+    if(!metricsFile.isEmpty())
+        MetricsRegistry::instance()->writeJson(metricsFile);
+
+    trace->write();
+
+    return exitCode;
+}
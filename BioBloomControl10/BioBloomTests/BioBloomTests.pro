@@ -0,0 +1,18 @@
+#-------------------------------------------------
+#
+# Unit tests for BioBloomCore, one test program per class or
+# pipeline stage. Run with "make check"
+#
+#-------------------------------------------------
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    commanddebouncer \
+    fairrequestqueue \
+    hubclient \
+    hubfieldreader \
+    plantprofilecatalog \
+    pollscheduler \
+    sensorrecords \
+    sensorrollup
@@ -0,0 +1,14 @@
+# Included by every test program under BioBloomTests: a QtTest console
+# application linked against BioBloomCore
+
+QT       += core
+QT       += testlib
+QT       -= gui
+
+TEMPLATE = app
+CONFIG += console testcase
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+include(../BioBloomCore/BioBloomCore.pri)
@@ -0,0 +1,7 @@
+TARGET = tst_commanddebouncer
+
+include(../biobloomtest.pri)
+include(../scriptedhub/scriptedhub.pri)
+
+SOURCES += \
+    tst_commanddebouncer.cpp \
@@ -0,0 +1,156 @@
+/*                  Header Files                */
+#include <QtTest>
+
+#include "commanddebouncer.h"
+#include "hubclient.h"
+#include "scriptedhub.h"
+
+/*
+ * A pot control's presses collapsed into commands, watched from the hub's
+ * side: a burst sends its newest value once, a newer value waits while the
+ * previous command is on the wire and follows it, a command still queued is
+ * replaced, and a debouncer destroyed mid-gesture still sends its value.
+ */
+
+/*          Class Declarations          */
+class TestCommandDebouncer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanup();
+    void burstSendsNewestValueOnce();
+    void inFlightCommandHoldsBackNewerValue();
+    void queuedCommandIsReplaced();
+    void pendingValueSentOnDestruction();
+
+private:
+    ScriptedHub hub;
+    HubClient* client;
+
+    QStringList sentVolumes();                                  //volume field of every volume_request the hub saw
+};
+
+
+
+/*              Test Helpers                    */
+QStringList TestCommandDebouncer::sentVolumes()
+{
+    QStringList volumes;
+
+    for(int i = 0; i < hub.requestCount; i++)
+        if(hub.requestScripts[i] == "volume_request.php")
+            volumes.append(hub.requestForms[i].queryItemValue("volume"));
+
+    return volumes;
+}
+
+
+
+/*              Test Slots                      */
+void TestCommandDebouncer::initTestCase()
+{
+    QVERIFY(hub.listen());
+
+    qputenv("BIOBLOOM_HUB_URL", hub.getUrl().toEncoded());                    //Nothing should try the real hub
+    client = HubClient::instance();
+}
+
+void TestCommandDebouncer::cleanup()
+{
+    hub.holdFlag = false;
+    hub.releaseHeld();
+
+    QTRY_COMPARE(client->getInFlightCount() + client->getQueuedCount(), 0);
+    client->setInFlightLimits(6, 2);
+
+    hub.reset();
+}
+
+void TestCommandDebouncer::burstSendsNewestValueOnce()
+{
+    CommandDebouncer debouncer(CommandDebouncer::Volume, "aa:bb:cc:dd:ee:01");
+    debouncer.setQuietInterval(100);
+
+    for(int volume = 1; volume <= 10; volume++)
+        debouncer.submit(QStringList() << QString::number(volume));           //Slider dragged, one press per step
+
+    QTest::qWait(50);
+    QCOMPARE(hub.requestCount, 0);                                            //Still inside the quiet window
+
+    QTRY_COMPARE(hub.requestCount, 1);
+    QTest::qWait(200);
+
+    QCOMPARE(sentVolumes(), QStringList() << "10");
+}
+
+void TestCommandDebouncer::inFlightCommandHoldsBackNewerValue()
+{
+    CommandDebouncer debouncer(CommandDebouncer::Volume, "aa:bb:cc:dd:ee:01");
+    hub.holdFlag = true;
+
+    debouncer.submit(QStringList() << "3");
+    debouncer.flush();
+    QTRY_COMPARE(hub.requestCount, 1);
+
+    debouncer.submit(QStringList() << "4");
+    debouncer.flush();
+    debouncer.submit(QStringList() << "5");
+    debouncer.flush();
+
+    QTest::qWait(200);
+    QCOMPARE(hub.requestCount, 1);                                            //The pot may be acting on 3, nothing is aborted or sent
+    QCOMPARE(client->getInFlightCount(), 1);
+
+    hub.holdFlag = false;
+    hub.releaseHeld();
+
+    QTRY_COMPARE(hub.requestCount, 2);                                        //Newest value follows once 3 is answered
+    QTest::qWait(200);
+
+    QCOMPARE(sentVolumes(), QStringList() << "3" << "5");
+}
+
+void TestCommandDebouncer::queuedCommandIsReplaced()
+{
+    CommandDebouncer debouncer(CommandDebouncer::Volume, "aa:bb:cc:dd:ee:01");
+    hub.holdFlag = true;
+    client->setInFlightLimits(1, 1);
+
+    client->ribbonBoot();                                                     //Holds the only slot
+    QTRY_COMPARE(hub.requestCount, 1);
+
+    debouncer.submit(QStringList() << "6");
+    debouncer.flush();
+    QCOMPARE(client->getQueuedCount(), 1);
+
+    debouncer.submit(QStringList() << "7");
+    debouncer.flush();
+    QCOMPARE(client->getQueuedCount(), 1);                                    //6 never reached the pot and was aborted
+
+    hub.holdFlag = false;
+    hub.releaseHeld();
+
+    QTRY_COMPARE(hub.requestCount, 2);
+    QTest::qWait(200);
+
+    QCOMPARE(sentVolumes(), QStringList() << "7");
+}
+
+void TestCommandDebouncer::pendingValueSentOnDestruction()
+{
+    CommandDebouncer* debouncer = new CommandDebouncer(CommandDebouncer::Rgb, "aa:bb:cc:dd:ee:01");
+    debouncer->setQuietInterval(10000);
+
+    debouncer->submit(QStringList() << "10" << "20" << "30");
+    delete debouncer;                                                         //Window closed mid gesture
+
+    QTRY_COMPARE(hub.requestCount, 1);
+    QCOMPARE(hub.requestScripts[0], QString("rgb_request.php"));
+    QCOMPARE(hub.requestForms[0].queryItemValue("g"), QString("20"));
+}
+
+QTEST_GUILESS_MAIN(TestCommandDebouncer)
+
+#include "tst_commanddebouncer.moc"
@@ -0,0 +1,6 @@
+TARGET = tst_fairrequestqueue
+
+include(../biobloomtest.pri)
+
+SOURCES += \
+    tst_fairrequestqueue.cpp \
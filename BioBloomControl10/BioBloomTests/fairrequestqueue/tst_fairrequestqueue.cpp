@@ -0,0 +1,109 @@
+/*                  Header Files                */
+#include <QtTest>
+
+#include "fairrequestqueue.h"
+#include "hubclient.h"
+
+/*
+ * The per pot rotation HubClient draws waiting requests from: pots take turns
+ * however long their own backlog is, and a pot at its in-flight limit is
+ * passed over until one of its requests finishes.
+ */
+
+/*          Class Declarations          */
+class TestFairRequestQueue : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void unitsTakeTurns();
+    void busyUnitIsPassedOver();
+    void removedReplyGivesUpItsTurn();
+};
+
+
+
+/*              Test Slots                      */
+void TestFairRequestQueue::unitsTakeTurns()
+{
+    HubReply a1(HubClient::GraphData, "A"), a2(HubClient::GraphData, "A"), a3(HubClient::GraphData, "A");
+    HubReply b1(HubClient::RecentEntry, "B");
+    HubReply c1(HubClient::GraphData, "C"), c2(HubClient::GraphData, "C");
+
+    FairRequestQueue queue;
+    queue.append("A", &a1);
+    queue.append("A", &a2);
+    queue.append("A", &a3);
+    queue.append("B", &b1);
+    queue.append("C", &c1);
+    queue.append("C", &c2);
+
+    QCOMPARE(queue.count(), 6);
+
+    QHash<QString, int> busyUnits;
+    QList<HubReply*> order;
+
+    while(HubReply* reply = queue.takeNext(busyUnits, 2))
+        order.append(reply);
+
+    QList<HubReply*> expected;
+    expected << &a1 << &b1 << &c1 << &a2 << &c2 << &a3;                       //A's backlog waits behind one request from each other pot
+
+    QVERIFY(order == expected);
+    QVERIFY(queue.isEmpty());
+}
+
+void TestFairRequestQueue::busyUnitIsPassedOver()
+{
+    HubReply a1(HubClient::GraphData, "A");
+    HubReply b1(HubClient::RecentEntry, "B");
+    HubReply fleet1(HubClient::FleetSnapshot, ""), fleet2(HubClient::FleetSnapshot, "");
+
+    FairRequestQueue queue;
+    queue.append("A", &a1);
+    queue.append("B", &b1);
+
+    QHash<QString, int> busyUnits;
+    busyUnits.insert("A", 2);
+
+    QCOMPARE(queue.takeNext(busyUnits, 2), &b1);
+    QCOMPARE(queue.takeNext(busyUnits, 2), (HubReply*)nullptr);               //Nothing else can go, A stays queued
+    QCOMPARE(queue.count(), 1);
+
+    busyUnits.insert("A", 1);
+    QCOMPARE(queue.takeNext(busyUnits, 2), &a1);
+    QVERIFY(queue.isEmpty());
+
+    queue.append("", &fleet1);                                                //Requests naming no pot are never held back
+    queue.append("", &fleet2);
+    busyUnits.insert("", 5);
+
+    QCOMPARE(queue.takeNext(busyUnits, 2), &fleet1);
+    QCOMPARE(queue.takeNext(busyUnits, 2), &fleet2);
+}
+
+void TestFairRequestQueue::removedReplyGivesUpItsTurn()
+{
+    HubReply a1(HubClient::GraphData, "A");
+    HubReply b1(HubClient::GraphData, "B"), b2(HubClient::GraphData, "B");
+
+    FairRequestQueue queue;
+    queue.append("A", &a1);
+    queue.append("B", &b1);
+    queue.append("B", &b2);
+
+    QVERIFY(queue.remove("A", &a1));
+    QVERIFY(!queue.remove("A", &a1));                                         //Already gone
+    QVERIFY(!queue.remove("A", &b1));                                         //Queued under another pot
+    QCOMPARE(queue.count(), 2);
+
+    QHash<QString, int> busyUnits;
+
+    QCOMPARE(queue.takeNext(busyUnits, 2), &b1);
+    QCOMPARE(queue.takeNext(busyUnits, 2), &b2);
+    QCOMPARE(queue.takeNext(busyUnits, 2), (HubReply*)nullptr);
+}
+
+QTEST_GUILESS_MAIN(TestFairRequestQueue)
+
+#include "tst_fairrequestqueue.moc"
@@ -0,0 +1,7 @@
+TARGET = tst_hubclient
+
+include(../biobloomtest.pri)
+include(../scriptedhub/scriptedhub.pri)
+
+SOURCES += \
+    tst_hubclient.cpp \
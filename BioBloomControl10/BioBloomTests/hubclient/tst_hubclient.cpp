@@ -0,0 +1,305 @@
+/*                  Header Files                */
+#include <QtTest>
+
+#include "hubclient.h"
+#include "scriptedhub.h"
+
+/*
+ * The HubClient pipeline against a scripted hub on a local port: failed
+ * reads are retried with their attempts counted and commands are not, a
+ * request the hub never answers times out, and no more requests are on the
+ * wire than the total and per pot limits allow. Identical reads share one
+ * request, and whichever caller cancels, the others still get their answer.
+ */
+
+/*          Class Declarations          */
+class ReplyCollector : public QObject
+{
+    Q_OBJECT
+
+public:
+    struct Result
+    {
+        bool errorFlag;
+        bool timedOutFlag;
+        bool cancelledFlag;
+        bool joinedFlag;
+        int attemptCount;
+        QByteArray data;
+    };
+
+    QList<Result> results;
+
+public slots:
+    void finishedSlot(HubReply* reply);
+};
+
+class TestHubClient : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanup();
+    void readIsRetriedUntilItSucceeds();
+    void retriesStopAfterThreeAttempts();
+    void commandIsNotRetried();
+    void unansweredRequestTimesOut();
+    void inFlightLimitsHold();
+    void identicalReadsShareOneRequest();
+    void cancelledJoinerLeavesLeaderRunning();
+    void cancelledLeaderHandsOver();
+
+private:
+    ScriptedHub hub;
+    HubClient* client;
+};
+
+
+
+/*              Reply Collector                 */
+void ReplyCollector::finishedSlot(HubReply* reply)
+{
+    Result result = {reply->isError(), reply->isTimedOut(), reply->isCancelled(), reply->isJoined(),
+                     reply->getAttemptCount(), reply->data()};
+    results.append(result);
+}
+
+
+
+/*              Test Slots                      */
+void TestHubClient::initTestCase()
+{
+    QVERIFY(hub.listen());
+
+    qputenv("BIOBLOOM_HUB_URL", hub.getUrl().toEncoded());                    //Nothing should try the real hub
+    client = HubClient::instance();
+    QCOMPARE(client->getHubUrl(), hub.getUrl());
+}
+
+void TestHubClient::cleanup()
+{
+    hub.releaseHeld();
+    hub.holdFlag = false;
+    hub.statusScript.clear();
+
+    QTRY_COMPARE(client->getInFlightCount() + client->getQueuedCount(), 0);
+    client->setInFlightLimits(6, 2);
+
+    hub.reset();
+}
+
+void TestHubClient::readIsRetriedUntilItSucceeds()
+{
+    ReplyCollector collector;
+    hub.statusScript << 500 << 503;                                           //The hub fails twice, then answers
+
+    HubReply* reply = client->ribbonBoot();
+    connect(reply, SIGNAL(finished(HubReply*)), &collector, SLOT(finishedSlot(HubReply*)));
+
+    QTRY_COMPARE_WITH_TIMEOUT(collector.results.count(), 1, 5000);            //Retry delays are 0.5 s then 1 s
+    QVERIFY(!collector.results[0].errorFlag);
+    QCOMPARE(collector.results[0].attemptCount, 3);
+    QCOMPARE(collector.results[0].data, QByteArray("105,450,320,215,800,950,"));
+    QCOMPARE(hub.requestCount, 3);
+}
+
+void TestHubClient::retriesStopAfterThreeAttempts()
+{
+    ReplyCollector collector;
+    hub.statusScript << 500 << 500 << 500;
+
+    HubReply* reply = client->returnMacs();
+    connect(reply, SIGNAL(finished(HubReply*)), &collector, SLOT(finishedSlot(HubReply*)));
+
+    QTRY_COMPARE_WITH_TIMEOUT(collector.results.count(), 1, 5000);
+    QVERIFY(collector.results[0].errorFlag);
+    QCOMPARE(collector.results[0].attemptCount, 3);
+    QCOMPARE(hub.requestCount, 3);
+
+    ReplyCollector notFound;                                                  //A 404 will not go away by asking again
+    hub.statusScript << 404;
+
+    reply = client->returnMacs();
+    connect(reply, SIGNAL(finished(HubReply*)), &notFound, SLOT(finishedSlot(HubReply*)));
+
+    QTRY_COMPARE(notFound.results.count(), 1);
+    QVERIFY(notFound.results[0].errorFlag);
+    QCOMPARE(notFound.results[0].attemptCount, 1);
+}
+
+void TestHubClient::commandIsNotRetried()
+{
+    ReplyCollector collector;
+    hub.statusScript << 500;
+
+    HubReply* reply = client->actionRequest("aa:bb:cc:dd:ee:01", "1");
+    connect(reply, SIGNAL(finished(HubReply*)), &collector, SLOT(finishedSlot(HubReply*)));
+
+    QTRY_COMPARE(collector.results.count(), 1);
+    QVERIFY(collector.results[0].errorFlag);
+    QCOMPARE(collector.results[0].attemptCount, 1);                           //The pot may already have acted on it
+
+    QTest::qWait(1000);                                                       //Longer than the first retry delay
+    QCOMPARE(hub.requestCount, 1);
+}
+
+void TestHubClient::unansweredRequestTimesOut()
+{
+    ReplyCollector collector;
+    hub.holdFlag = true;
+
+    HubReply* reply = client->personalisePlant("aa:bb:cc:dd:ee:01", "Basil", "basil");      //5 s timeout, never retried
+    connect(reply, SIGNAL(finished(HubReply*)), &collector, SLOT(finishedSlot(HubReply*)));
+
+    QTest::qWait(4000);
+    QCOMPARE(collector.results.count(), 0);
+
+    QTRY_COMPARE_WITH_TIMEOUT(collector.results.count(), 1, 3000);
+    QVERIFY(collector.results[0].errorFlag);
+    QVERIFY(collector.results[0].timedOutFlag);
+    QCOMPARE(collector.results[0].attemptCount, 1);
+    QCOMPARE(client->getInFlightCount(), 0);                                  //The slot was given back
+}
+
+void TestHubClient::inFlightLimitsHold()
+{
+    ReplyCollector collector;
+    hub.holdFlag = true;
+    client->setInFlightLimits(3, 1);
+
+    QStringList macs;
+    macs << "aa:bb:cc:dd:ee:01" << "aa:bb:cc:dd:ee:01" << "aa:bb:cc:dd:ee:01"
+         << "aa:bb:cc:dd:ee:02" << "aa:bb:cc:dd:ee:03" << "aa:bb:cc:dd:ee:03";
+
+    for(int i = 0; i < macs.count(); i++)
+    {
+        HubReply* reply = client->graphData(macs[i], i + 1);                   //Different cursors, so nothing is joined
+        connect(reply, SIGNAL(finished(HubReply*)), &collector, SLOT(finishedSlot(HubReply*)));
+    }
+
+    QTRY_COMPARE(hub.requestCount, 3);                                        //One per pot
+    QTest::qWait(200);
+
+    QCOMPARE(hub.requestCount, 3);
+    QCOMPARE(hub.maximumOpenPerUnit, 1);
+    QCOMPARE(client->getInFlightCount(), 3);
+    QCOMPARE(client->getQueuedCount(), 3);
+
+    hub.holdFlag = false;
+    hub.releaseHeld();
+
+    QTRY_COMPARE(collector.results.count(), macs.count());
+    QCOMPARE(hub.requestCount, macs.count());
+    QVERIFY(hub.maximumOpenCount <= 3);
+    QCOMPARE(hub.maximumOpenPerUnit, 1);
+
+    for(int i = 0; i < collector.results.count(); i++)
+        QVERIFY(!collector.results[i].errorFlag);
+}
+
+void TestHubClient::identicalReadsShareOneRequest()
+{
+    ReplyCollector collector;
+    hub.holdFlag = true;
+
+    QList<HubReply*> replies;
+    replies << client->graphData("aa:bb:cc:dd:ee:01", 5) << client->graphData("aa:bb:cc:dd:ee:01", 5)
+            << client->graphData("aa:bb:cc:dd:ee:01", 5) << client->graphData("aa:bb:cc:dd:ee:01", 6);      //Last one asks for other rows
+
+    for(int i = 0; i < replies.count(); i++)
+        connect(replies[i], SIGNAL(finished(HubReply*)), &collector, SLOT(finishedSlot(HubReply*)));
+
+    QVERIFY(!replies[0]->isJoined());
+    QVERIFY(replies[1]->isJoined());
+    QVERIFY(replies[2]->isJoined());
+    QVERIFY(!replies[3]->isJoined());
+    QCOMPARE(replies[1]->getState(), HubReply::Joined);
+
+    QTRY_COMPARE(hub.requestCount, 2);
+    QTest::qWait(200);
+    QCOMPARE(hub.requestCount, 2);
+
+    hub.releaseHeld();
+
+    QTRY_COMPARE(collector.results.count(), replies.count());
+
+    for(int i = 0; i < collector.results.count(); i++)
+    {
+        QVERIFY(!collector.results[i].errorFlag);
+        QCOMPARE(collector.results[i].data, QByteArray("105,450,320,215,800,950,"));
+    }
+
+    ReplyCollector later;                                                     //Once answered, the same read goes out afresh
+    hub.holdFlag = false;
+
+    HubReply* reply = client->graphData("aa:bb:cc:dd:ee:01", 5);
+    connect(reply, SIGNAL(finished(HubReply*)), &later, SLOT(finishedSlot(HubReply*)));
+
+    QVERIFY(!reply->isJoined());
+    QTRY_COMPARE(later.results.count(), 1);
+    QCOMPARE(hub.requestCount, 3);
+}
+
+void TestHubClient::cancelledJoinerLeavesLeaderRunning()
+{
+    ReplyCollector leaderCollector;
+    ReplyCollector joinerCollector;
+    hub.holdFlag = true;
+
+    HubReply* leader = client->returnMacs();
+    HubReply* joiner = client->returnMacs();
+    connect(leader, SIGNAL(finished(HubReply*)), &leaderCollector, SLOT(finishedSlot(HubReply*)));
+    connect(joiner, SIGNAL(finished(HubReply*)), &joinerCollector, SLOT(finishedSlot(HubReply*)));
+
+    QTRY_COMPARE(hub.requestCount, 1);
+
+    joiner->abort();
+
+    QCOMPARE(joinerCollector.results.count(), 1);                             //Finished straight away
+    QVERIFY(joinerCollector.results[0].cancelledFlag);
+    QCOMPARE(leaderCollector.results.count(), 0);
+
+    hub.releaseHeld();
+
+    QTRY_COMPARE(leaderCollector.results.count(), 1);
+    QVERIFY(!leaderCollector.results[0].errorFlag);
+    QCOMPARE(joinerCollector.results.count(), 1);                             //Not told twice
+    QCOMPARE(hub.requestCount, 1);
+}
+
+void TestHubClient::cancelledLeaderHandsOver()
+{
+    ReplyCollector leaderCollector;
+    ReplyCollector joinerCollector;
+    hub.holdFlag = true;
+
+    HubReply* leader = client->fleetSnapshot();
+    HubReply* heir = client->fleetSnapshot();
+    HubReply* joiner = client->fleetSnapshot();
+    connect(leader, SIGNAL(finished(HubReply*)), &leaderCollector, SLOT(finishedSlot(HubReply*)));
+    connect(heir, SIGNAL(finished(HubReply*)), &joinerCollector, SLOT(finishedSlot(HubReply*)));
+    connect(joiner, SIGNAL(finished(HubReply*)), &joinerCollector, SLOT(finishedSlot(HubReply*)));
+
+    QTRY_COMPARE(hub.requestCount, 1);
+
+    leader->abort();                                                          //The first joiner sends the read again for both
+
+    QTRY_COMPARE(leaderCollector.results.count(), 1);
+    QVERIFY(leaderCollector.results[0].cancelledFlag);
+    QVERIFY(!heir->isJoined());
+    QVERIFY(joiner->isJoined());
+
+    QTRY_VERIFY(hub.requestCount >= 2);                                       //Qt may also resend one pipelined behind the aborted read
+    QCOMPARE(joinerCollector.results.count(), 0);
+
+    hub.releaseHeld();
+
+    QTRY_COMPARE(joinerCollector.results.count(), 2);
+    QVERIFY(!joinerCollector.results[0].errorFlag);
+    QVERIFY(!joinerCollector.results[1].errorFlag);
+}
+
+QTEST_GUILESS_MAIN(TestHubClient)
+
+#include "tst_hubclient.moc"
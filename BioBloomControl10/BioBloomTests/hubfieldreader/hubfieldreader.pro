@@ -0,0 +1,6 @@
+TARGET = tst_hubfieldreader
+
+include(../biobloomtest.pri)
+
+SOURCES += \
+    tst_hubfieldreader.cpp \
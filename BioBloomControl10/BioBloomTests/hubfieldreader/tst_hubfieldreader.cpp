@@ -0,0 +1,75 @@
+/*                  Header Files                */
+#include <QtTest>
+
+#include "hubfieldreader.h"
+
+/*
+ * Field splitting and number parsing for the comma separated hub replies.
+ * toNumber() stands in for the QString::toDouble it replaced, so it must
+ * accept and refuse the same text.
+ */
+
+/*          Class Declarations          */
+class TestHubFieldReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void emptyFieldsAreSkipped();
+    void toNumber_data();
+    void toNumber();
+};
+
+
+
+/*              Test Slots                      */
+void TestHubFieldReader::emptyFieldsAreSkipped()
+{
+    HubFieldReader fields(QByteArray("aa:bb, 12,,-3.5 ,\r\n"));
+    QLatin1String field;
+
+    QVERIFY(fields.next(field));
+    QCOMPARE(QString(field), QString("aa:bb"));
+    QVERIFY(fields.next(field));
+    QCOMPARE(QString(field), QString("12"));
+    QVERIFY(fields.next(field));
+    QCOMPARE(QString(field), QString("-3.5"));
+    QVERIFY(!fields.next(field));
+}
+
+void TestHubFieldReader::toNumber_data()
+{
+    QTest::addColumn<QByteArray>("text");
+
+    QTest::newRow("integer") << QByteArray("215");
+    QTest::newRow("negative") << QByteArray("-15");
+    QTest::newRow("plus sign") << QByteArray("+7");
+    QTest::newRow("fraction") << QByteArray("21.75");
+    QTest::newRow("no integer part") << QByteArray(".5");
+    QTest::newRow("no fraction digits") << QByteArray("5.");
+    QTest::newRow("exponent") << QByteArray("1e3");
+    QTest::newRow("negative exponent") << QByteArray("2.5E-1");
+    QTest::newRow("trailing garbage") << QByteArray("12abc");
+    QTest::newRow("bare exponent") << QByteArray("1e");
+    QTest::newRow("bare sign") << QByteArray("-");
+    QTest::newRow("bare point") << QByteArray(".");
+    QTest::newRow("word") << QByteArray("NULL");
+}
+
+void TestHubFieldReader::toNumber()
+{
+    QFETCH(QByteArray, text);
+
+    bool expectedOk;
+    double expected = QString::fromLatin1(text).toDouble(&expectedOk);
+
+    bool ok;
+    double value = HubFieldReader::toNumber(QLatin1String(text.constData(), text.size()), &ok);
+
+    QCOMPARE(ok, expectedOk);
+    QCOMPARE(value, expected);                                                //toDouble gives 0 when it refuses too
+}
+
+QTEST_GUILESS_MAIN(TestHubFieldReader)
+
+#include "tst_hubfieldreader.moc"
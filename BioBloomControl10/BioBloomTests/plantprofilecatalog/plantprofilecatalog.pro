@@ -0,0 +1,6 @@
+TARGET = tst_plantprofilecatalog
+
+include(../biobloomtest.pri)
+
+SOURCES += \
+    tst_plantprofilecatalog.cpp \
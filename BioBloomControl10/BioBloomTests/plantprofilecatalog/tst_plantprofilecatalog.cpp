@@ -0,0 +1,115 @@
+/*                  Header Files                */
+#include <QtTest>
+#include <QTemporaryDir>
+#include <QSettings>
+
+#include "plantprofilecatalog.h"
+
+/*
+ * The custom species data file named by profiles/dataFile, read by the
+ * catalog on first use: comments and blank lines are skipped, malformed
+ * lines are reported by number and skipped, and a custom species with a
+ * built-in name replaces it without moving it in the list.
+ */
+
+/*              Test Data File                  */
+static const char* const dataFileText =
+    "# name,temperature,light,moisture,humidity\n"
+    "\n"
+    "Basil,25,80,55,50\n"
+    "  Orchid , 21 , 60 , 40 , 70  \r\n"                                        //Padding and a Windows line ending
+    "Peace Lily,23,60,65,55\n"                                                  //Replaces the built-in one
+    "Fern,18,40,70\n"                                                           //Line 6, a field short
+    "Mint,twenty,70,60,50\n"                                                    //Line 7, not a number
+    ",20,70,60,50\n"                                                            //Line 8, no name
+    "Basil,24,85,50,45\n";                                                      //Later line wins
+
+/*          Class Declarations          */
+class TestPlantProfileCatalog : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void customProfilesAreLoaded();
+    void builtInProfileIsReplacedInPlace();
+    void malformedLinesAreSkipped();
+    void unknownNameFallsBackToDefault();
+
+private:
+    QTemporaryDir settingsDir;
+    PlantProfileCatalog* catalog;
+};
+
+
+
+/*              Test Slots                      */
+void TestPlantProfileCatalog::initTestCase()
+{
+    QVERIFY(settingsDir.isValid());
+
+    QCoreApplication::setOrganizationName("BioBloomTests");
+    QSettings::setDefaultFormat(QSettings::IniFormat);
+    QSettings::setPath(QSettings::IniFormat, QSettings::UserScope, settingsDir.path());      //Never the user's own settings
+
+    QFile dataFile(settingsDir.filePath("profiles.csv"));
+    QVERIFY(dataFile.open(QIODevice::WriteOnly));
+    dataFile.write(dataFileText);
+    dataFile.close();
+
+    {
+        QSettings settings;
+        settings.setValue("profiles/dataFile", dataFile.fileName());
+    }
+
+    for(int line = 6; line <= 8; line++)                                      //Each bad line has to be reported
+        QTest::ignoreMessage(QtDebugMsg, QRegularExpression(QString("^Skipping plant profile on line %1 of ").arg(line)));
+
+    catalog = PlantProfileCatalog::instance();                                //Reads the file now, once
+}
+
+void TestPlantProfileCatalog::customProfilesAreLoaded()
+{
+    QVERIFY(catalog->contains("Basil"));
+    QVERIFY(catalog->contains("Orchid"));                                     //Trimmed
+
+    PlantProfilePointer basil = catalog->profile("Basil");
+    QCOMPARE(basil->plantTypeName, QString("Basil"));
+    QCOMPARE(basil->idealTemp, 24);
+    QCOMPARE(basil->idealLight, 85);
+    QCOMPARE(basil->idealMoisture, 50);
+    QCOMPARE(basil->idealHumidity, 45);
+
+    PlantProfilePointer orchid = catalog->profile("Orchid");
+    QCOMPARE(orchid->idealTemp, 21);
+    QCOMPARE(orchid->idealHumidity, 70);
+}
+
+void TestPlantProfileCatalog::builtInProfileIsReplacedInPlace()
+{
+    QStringList expected;
+    expected << "Default" << "Aloe Cactus" << "Spider Plant" << "Peace Lily" << "Venus Fly Trap"
+             << "Basil" << "Orchid";
+
+    QCOMPARE(catalog->profileNames(), expected);
+    QCOMPARE(catalog->profile("Peace Lily")->idealTemp, 23);
+    QCOMPARE(catalog->profile("Peace Lily")->idealMoisture, 65);
+}
+
+void TestPlantProfileCatalog::malformedLinesAreSkipped()
+{
+    QVERIFY(!catalog->contains("Fern"));
+    QVERIFY(!catalog->contains("Mint"));
+    QVERIFY(!catalog->contains(""));
+}
+
+void TestPlantProfileCatalog::unknownNameFallsBackToDefault()
+{
+    QCOMPARE(catalog->profile("Fern"), catalog->defaultProfile());
+    QCOMPARE(catalog->defaultProfile()->plantTypeName, QString("Default"));
+    QCOMPARE(catalog->defaultProfile()->idealTemp, 24);
+}
+
+QTEST_GUILESS_MAIN(TestPlantProfileCatalog)
+
+#include "tst_plantprofilecatalog.moc"
@@ -0,0 +1,6 @@
+TARGET = tst_pollscheduler
+
+include(../biobloomtest.pri)
+
+SOURCES += \
+    tst_pollscheduler.cpp \
@@ -0,0 +1,142 @@
+/*                  Header Files                */
+#include <QtTest>
+
+#include "biobloomunit.h"
+#include "pollscheduler.h"
+#include "unitworker.h"
+
+/*
+ * The limits PollScheduler keeps every unit's polling inside: the bounds
+ * themselves are clamped to something sane, each worker's adaptive interval
+ * stays between them however its readings move, and the timer never polls a
+ * unit faster than the minimum.
+ */
+
+/*          Class Declarations          */
+class TestPollScheduler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void boundsAreClamped_data();
+    void boundsAreClamped();
+    void pollIntervalAndJitterStayInRange();
+    void workerIntervalStaysInsideBounds();
+    void unitIsNotPolledFasterThanMinimum();
+};
+
+
+
+/*              Test Slots                      */
+void TestPollScheduler::boundsAreClamped_data()
+{
+    QTest::addColumn<int>("minimum");
+    QTest::addColumn<int>("maximum");
+    QTest::addColumn<int>("expectedMinimum");
+    QTest::addColumn<int>("expectedMaximum");
+    QTest::addColumn<int>("expectedPollInterval");
+
+    QTest::newRow("defaults") << 15000 << 600000 << 15000 << 600000 << 60000;
+    QTest::newRow("below a second") << 10 << 500 << 1000 << 1000 << 1000;
+    QTest::newRow("maximum under minimum") << 90000 << 30000 << 90000 << 90000 << 90000;
+    QTest::newRow("maximum under the poll interval") << 5000 << 20000 << 5000 << 20000 << 20000;
+}
+
+void TestPollScheduler::boundsAreClamped()
+{
+    QFETCH(int, minimum);
+    QFETCH(int, maximum);
+    QFETCH(int, expectedMinimum);
+    QFETCH(int, expectedMaximum);
+    QFETCH(int, expectedPollInterval);
+
+    PollScheduler scheduler;
+    scheduler.setIntervalBounds(minimum, maximum);
+
+    QCOMPARE(scheduler.getMinimumInterval(), expectedMinimum);
+    QCOMPARE(scheduler.getMaximumInterval(), expectedMaximum);
+    QCOMPARE(scheduler.getPollInterval(), expectedPollInterval);               //Starting interval is pulled inside the new bounds
+}
+
+void TestPollScheduler::pollIntervalAndJitterStayInRange()
+{
+    PollScheduler scheduler;
+    scheduler.setIntervalBounds(30000, 120000);
+
+    scheduler.setPollInterval(1000);
+    QCOMPARE(scheduler.getPollInterval(), 30000);
+    scheduler.setPollInterval(3600000);
+    QCOMPARE(scheduler.getPollInterval(), 120000);
+
+    scheduler.setJitterFraction(2.0);
+    QCOMPARE(scheduler.getJitterFraction(), 0.5);                             //More would let deadlines cross
+    scheduler.setJitterFraction(-1.0);
+    QCOMPARE(scheduler.getJitterFraction(), 0.0);
+}
+
+void TestPollScheduler::workerIntervalStaysInsideBounds()
+{
+    BioBloomUnit unit;
+    unit.changeCurrentMoisture(40);
+    unit.changeCurrentTemp(21);
+    unit.changeCurrentLight(60);
+
+    UnitWorker worker(&unit);
+    PollScheduler scheduler;
+    scheduler.setIntervalBounds(20000, 160000);
+    scheduler.setPollInterval(40000);
+    scheduler.addWorker(&worker);
+
+    QCOMPARE(worker.getPollInterval(), 40000);
+
+    for(int i = 0; i < 8; i++)                                                //Flat readings back off, but only as far as the maximum
+    {
+        worker.readingReceivedSlot();
+        QTest::qWait(5);
+    }
+
+    QCOMPARE(worker.getPollInterval(), 160000);
+
+    QSignalSpy shortened(&worker, SIGNAL(pollIntervalShortened(UnitWorker*)));
+    worker.plantWateredSlot();                                                //Watering pulls it straight to the minimum
+
+    QCOMPARE(worker.getPollInterval(), 20000);
+    QCOMPARE(shortened.count(), 1);
+
+    worker.plantWateredSlot();                                                //Already there, the scheduler is not told again
+    QCOMPARE(shortened.count(), 1);
+
+    scheduler.setIntervalBounds(50000, 100000);                               //Bounds moved under a running worker
+    QCOMPARE(worker.getPollInterval(), 50000);
+
+    scheduler.setIntervalBounds(10000, 30000);
+    QCOMPARE(worker.getPollInterval(), 30000);
+}
+
+void TestPollScheduler::unitIsNotPolledFasterThanMinimum()
+{
+    BioBloomUnit unit;
+    UnitWorker worker(&unit);
+    QSignalSpy polls(&worker, SIGNAL(dataRequestSignal()));
+
+    PollScheduler scheduler;
+    scheduler.setIntervalBounds(1000, 1000);                                  //Shortest the scheduler allows
+    scheduler.setJitterFraction(0);
+    scheduler.addWorker(&worker);
+    scheduler.start();
+
+    QTest::qWait(3500);                                                       //First poll inside the first second, then one a second
+
+    QVERIFY(polls.count() >= 3);
+    QVERIFY(polls.count() <= 4);
+
+    scheduler.stop();
+    int pollsWhenStopped = polls.count();
+
+    QTest::qWait(1500);
+    QCOMPARE(polls.count(), pollsWhenStopped);
+}
+
+QTEST_GUILESS_MAIN(TestPollScheduler)
+
+#include "tst_pollscheduler.moc"
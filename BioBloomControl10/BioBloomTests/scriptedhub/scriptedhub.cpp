@@ -0,0 +1,110 @@
+/*                  Header File                 */
+#include "scriptedhub.h"
+
+/*               Class Constructor              */
+ScriptedHub::ScriptedHub(QObject *parent) : QObject(parent)
+{
+    holdFlag = false;
+    openCount = 0;
+    reset();
+
+    connect(&server, SIGNAL(newConnection()), this, SLOT(newConnectionSlot()));
+}
+
+
+
+/*              Class Methods                   */
+bool ScriptedHub::listen()
+{
+    return server.listen(QHostAddress::LocalHost);
+}
+
+QUrl ScriptedHub::getUrl()
+{
+    return QUrl(QString("http://127.0.0.1:%1/").arg(server.serverPort()));
+}
+
+void ScriptedHub::releaseHeld()
+{
+    QList<HeldRequest> held = heldRequests;                                   //In arrival order, so pipelined replies stay in order
+    heldRequests.clear();
+
+    for(int i = 0; i < held.count(); i++)
+        answer(held[i].socket, held[i].mac, 200);
+}
+
+void ScriptedHub::reset()
+{
+    requestCount = 0;
+    requestScripts.clear();
+    requestForms.clear();
+    maximumOpenCount = 0;
+    maximumOpenPerUnit = 0;
+}
+
+void ScriptedHub::answer(QTcpSocket* socket, QString mac, int status)
+{
+    QByteArray body = (status == 200) ? QByteArray("105,450,320,215,800,950,") : QByteArray();
+
+    socket->write("HTTP/1.1 " + QByteArray::number(status) + (status == 200 ? " OK" : " Failed") + "\r\n"
+                  "Content-Type: text/html\r\n"
+                  "Content-Length: " + QByteArray::number(body.size()) + "\r\n"
+                  "\r\n" + body);
+
+    openCount--;
+    openPerUnit[mac]--;
+}
+
+
+
+/*               Class Slots                    */
+void ScriptedHub::newConnectionSlot()
+{
+    while(QTcpSocket* socket = server.nextPendingConnection())
+        connect(socket, SIGNAL(readyRead()), this, SLOT(readyReadSlot()));
+}
+
+void ScriptedHub::readyReadSlot()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+    QByteArray& buffer = socketBuffer[socket];
+    buffer += socket->readAll();
+
+    int headEnd;
+
+    while((headEnd = buffer.indexOf("\r\n\r\n")) >= 0)                          //The client may pipeline several requests
+    {
+        QByteArray head = buffer.left(headEnd);
+        QByteArray lowerHead = head.toLower();
+        int lengthStart = lowerHead.indexOf("content-length:");
+        int contentLength = lengthStart < 0 ? 0 : lowerHead.mid(lengthStart + 15, lowerHead.indexOf("\r\n", lengthStart) - lengthStart - 15).trimmed().toInt();
+
+        if(buffer.size() < headEnd + 4 + contentLength)
+            return;
+
+        QByteArray path = head.left(head.indexOf("\r\n")).split(' ').value(1);                 //"POST /graph_data.php HTTP/1.1"
+        QUrlQuery form(QString::fromUtf8(buffer.mid(headEnd + 4, contentLength)));
+        QString mac = form.queryItemValue("mac");
+        buffer.remove(0, headEnd + 4 + contentLength);
+
+        requestCount++;
+        requestScripts.append(QString::fromUtf8(path.mid(path.lastIndexOf('/') + 1)));
+        requestForms.append(form);
+
+        openCount++;
+        openPerUnit[mac]++;
+        maximumOpenCount = qMax(maximumOpenCount, openCount);
+
+        if(!mac.isEmpty())
+            maximumOpenPerUnit = qMax(maximumOpenPerUnit, openPerUnit[mac]);
+
+        if(holdFlag)
+        {
+            HeldRequest held = {socket, mac};
+            heldRequests.append(held);
+            continue;
+        }
+
+        answer(socket, mac, statusScript.isEmpty() ? 200 : statusScript.takeFirst());
+    }
+}
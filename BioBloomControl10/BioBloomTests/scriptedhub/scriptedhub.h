@@ -0,0 +1,66 @@
+/*      Define Header File      */
+#ifndef SCRIPTEDHUB_H
+#define SCRIPTEDHUB_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QHash>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QUrl>
+#include <QUrlQuery>
+
+/*
+ * A stand-in hub for the test programs. Each request is answered straight
+ * away with the next status from statusScript (200 with one sensor row once
+ * the script runs out), or held while holdFlag is set until releaseHeld().
+ * The script name and form of every request are kept, along with the most
+ * requests that were waiting on it at once, in total and for one pot.
+ */
+
+/*          Class Declarations          */
+class ScriptedHub : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit ScriptedHub(QObject *parent = nullptr);
+
+    bool listen();
+    QUrl getUrl();
+    void releaseHeld();                                         //Answers every held request with a 200
+    void reset();                                               //Forgets the requests seen so far
+
+    QList<int> statusScript;                                    //Status for each request in turn, 200 once it runs out
+    bool holdFlag;                                              //Keep requests unanswered until releaseHeld()
+
+    int requestCount;
+    QStringList requestScripts;                                 //"volume_request.php" and so on, in arrival order
+    QList<QUrlQuery> requestForms;
+    int openCount;
+    int maximumOpenCount;
+    int maximumOpenPerUnit;
+
+private slots:
+    void newConnectionSlot();
+    void readyReadSlot();
+
+private:
+    struct HeldRequest
+    {
+        QTcpSocket* socket;
+        QString mac;
+    };
+
+    QTcpServer server;
+    QHash<QTcpSocket*, QByteArray> socketBuffer;
+    QList<HeldRequest> heldRequests;
+    QHash<QString, int> openPerUnit;
+
+    void answer(QTcpSocket* socket, QString mac, int status);
+};
+
+#endif // SCRIPTEDHUB_H
@@ -0,0 +1,11 @@
+# Included by test programs that talk to a hub: a local HTTP server that
+# answers the way each test scripts it
+
+INCLUDEPATH += $$PWD
+DEPENDPATH += $$PWD
+
+SOURCES += \
+    $$PWD/scriptedhub.cpp \
+
+HEADERS += \
+    $$PWD/scriptedhub.h \
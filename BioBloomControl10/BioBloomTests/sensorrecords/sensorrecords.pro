@@ -0,0 +1,6 @@
+TARGET = tst_sensorrecords
+
+include(../biobloomtest.pri)
+
+SOURCES += \
+    tst_sensorrecords.cpp \
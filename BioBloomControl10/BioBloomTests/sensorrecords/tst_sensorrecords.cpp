@@ -0,0 +1,206 @@
+/*                  Header Files                */
+#include <QtTest>
+#include <QtEndian>
+
+#include "sensorrecords.h"
+
+/*
+ * Both sensor row formats the hub can send, checked against the same rows:
+ * the comma separated text and the packed records from sensor_records.php,
+ * whole or fed to the incremental parser in the chunks readyRead hands out.
+ * graph_data leads each row with the time the hub stored it.
+ */
+
+/*              Test Rows                       */
+static const int sampleRowCount = 3;
+static const int sampleRows[sampleRowCount][SensorRecords::ChannelCount] =
+{
+    {105, 450, 320, 215, 800, 950},                             //light, humidity, moisture, temperature, water, battery in tenths
+    {110, 460, 318, -15, 795, 949},                             //Below freezing, the binary values are signed
+    {0, 455, 300, 220, 790, 948}
+};
+static const quint32 sampleTimes[sampleRowCount] = {1538000000, 1538000015, 1538000615};     //15 seconds, then 10 minutes apart
+
+static QByteArray sampleText(bool timesFlag = false)
+{
+    QByteArray text;
+
+    for(int row = 0; row < sampleRowCount; row++)
+    {
+        if(timesFlag)
+            text += QByteArray::number(sampleTimes[row]) + ",";
+
+        for(int c = 0; c < SensorRecords::ChannelCount; c++)
+            text += QByteArray::number(sampleRows[row][c]) + ",";             //graph_data puts a comma after every value
+    }
+
+    return text;
+}
+
+static QByteArray sampleBinary(bool timesFlag = false)
+{
+    QByteArray packed("BB");
+    packed.append(char(1));                                                   //Version
+    packed.append(char(timesFlag ? 0x7F : 0x3F));                             //Every channel, and the times when asked
+
+    uchar bytes[4];
+    qToLittleEndian<quint32>(sampleRowCount, bytes);
+    packed.append(reinterpret_cast<const char*>(bytes), 4);
+
+    for(int row = 0; row < sampleRowCount; row++)
+    {
+        if(timesFlag)
+        {
+            qToLittleEndian<quint32>(sampleTimes[row], bytes);
+            packed.append(reinterpret_cast<const char*>(bytes), 4);
+        }
+
+        for(int c = 0; c < SensorRecords::ChannelCount; c++)
+        {
+            qToLittleEndian<qint16>(sampleRows[row][c], bytes);
+            packed.append(reinterpret_cast<const char*>(bytes), 2);
+        }
+    }
+
+    return packed;
+}
+
+static bool matchesSample(const SensorRecords &records, bool timesFlag = false)
+{
+    if(records.count() != sampleRowCount || records.hasTimes() != timesFlag)
+        return false;
+
+    for(int row = 0; row < sampleRowCount; row++)
+    {
+        if(timesFlag && records.recordedAt(row) != sampleTimes[row])
+            return false;
+
+        for(int c = 0; c < SensorRecords::ChannelCount; c++)
+            if(records.value(row, (SensorRecords::Channel)c) != sampleRows[row][c])
+                return false;
+    }
+
+    return true;
+}
+
+
+
+/*          Class Declarations          */
+class TestSensorRecords : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void textAndBinaryRowsMatch();
+    void timedRowsMatch();
+    void firstRecordFromTime();
+    void singleRowWithoutTrailingComma();
+    void truncatedBinaryIsRejected();
+    void rowSplitAcrossChunks_data();
+    void rowSplitAcrossChunks();
+};
+
+
+
+/*              Test Slots                      */
+void TestSensorRecords::textAndBinaryRowsMatch()
+{
+    SensorRecords text;
+    SensorRecords binary;
+
+    QVERIFY(text.parse(sampleText(), false));
+    QVERIFY(binary.parse(sampleBinary(), true));
+
+    QVERIFY(matchesSample(text));
+    QVERIFY(matchesSample(binary));
+}
+
+void TestSensorRecords::timedRowsMatch()
+{
+    SensorRecords text;
+    SensorRecords binary;
+
+    QVERIFY(text.parse(sampleText(true), false, true));
+    QVERIFY(binary.parse(sampleBinary(true), true));
+
+    QVERIFY(matchesSample(text, true));
+    QVERIFY(matchesSample(binary, true));
+}
+
+void TestSensorRecords::firstRecordFromTime()
+{
+    SensorRecords records;
+    QVERIFY(records.parse(sampleBinary(true), true));
+
+    QCOMPARE(records.firstRecordFrom(0), 0);
+    QCOMPARE(records.firstRecordFrom(sampleTimes[1]), 1);                     //A row stored exactly at the start is inside the range
+    QCOMPARE(records.firstRecordFrom(sampleTimes[1] + 1), 2);
+    QCOMPARE(records.firstRecordFrom(sampleTimes[2] + 1), sampleRowCount);
+}
+
+void TestSensorRecords::singleRowWithoutTrailingComma()
+{
+    SensorRecords recentEntry;                                                //recent_entry's one row ends without a comma
+
+    QVERIFY(recentEntry.parse("105,450,320,215,800,950", false));
+    QCOMPARE(recentEntry.count(), 1);
+    QCOMPARE(recentEntry.value(0, SensorRecords::LightLevel), 105.0);
+    QCOMPARE(recentEntry.value(0, SensorRecords::BatteryLevel), 950.0);
+}
+
+void TestSensorRecords::truncatedBinaryIsRejected()
+{
+    QByteArray packed = sampleBinary();
+    SensorRecords records;
+
+    QVERIFY(!records.parse(packed.left(packed.size() - 1), true));            //Short of the record count in the header
+    QVERIFY(!records.parse(packed.left(5), true));                            //Header cut off
+
+    packed[2] = 2;                                                            //Version this client does not know
+    QVERIFY(!records.parse(packed, true));
+}
+
+void TestSensorRecords::rowSplitAcrossChunks_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<bool>("binaryFlag");
+    QTest::addColumn<bool>("timesFlag");
+
+    QTest::newRow("text") << sampleText() << false << false;
+    QTest::newRow("binary") << sampleBinary() << true << false;
+    QTest::newRow("timed text") << sampleText(true) << false << true;
+    QTest::newRow("timed binary") << sampleBinary(true) << true << true;
+}
+
+void TestSensorRecords::rowSplitAcrossChunks()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(bool, binaryFlag);
+    QFETCH(bool, timesFlag);
+
+    for(int split = 1; split < data.size(); split++)                            //Through numbers, the binary header and value bytes
+    {
+        SensorRecords records;
+        records.begin(binaryFlag, data.size(), timesFlag);
+
+        QVERIFY(records.feed(data.constData(), split));
+        QVERIFY(records.feed(data.constData() + split, data.size() - split));
+        QVERIFY(records.finish());
+
+        if(!matchesSample(records, timesFlag))
+            QFAIL(qPrintable(QString("Rows split at byte %1 parsed differently").arg(split)));
+    }
+
+    SensorRecords byteAtATime;
+    byteAtATime.begin(binaryFlag, 0, timesFlag);
+
+    for(int i = 0; i < data.size(); i++)
+        QVERIFY(byteAtATime.feed(data.constData() + i, 1));
+
+    QVERIFY(byteAtATime.finish());
+    QVERIFY(matchesSample(byteAtATime, timesFlag));
+}
+
+QTEST_GUILESS_MAIN(TestSensorRecords)
+
+#include "tst_sensorrecords.moc"
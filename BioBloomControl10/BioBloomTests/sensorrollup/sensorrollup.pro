@@ -0,0 +1,6 @@
+TARGET = tst_sensorrollup
+
+include(../biobloomtest.pri)
+
+SOURCES += \
+    tst_sensorrollup.cpp \
@@ -0,0 +1,169 @@
+/*                  Header Files                */
+#include <QtTest>
+#include <cmath>
+
+#include "sensorrecords.h"
+#include "sensorrollup.h"
+
+/*
+ * Rollups kept next to a growing history the way UnitHistory keeps them:
+ * synced as rows are appended live, then resynced after the live rows are
+ * truncated away and the hub's own rows take their place. Buckets are spans
+ * of time, so rows that arrive at uneven intervals land by their time.
+ */
+
+/*              Test Helpers                    */
+static const double firstRowTime = 1538000400;                  //On a ten minute boundary
+
+static void appendRows(SensorRecords &records, int inputCount, int inputSeed, double inputFirstTime, int inputSpacing)
+{
+    for(int i = 0; i < inputCount; i++)
+    {
+        double row[SensorRecords::ChannelCount];
+
+        for(int c = 0; c < SensorRecords::ChannelCount; c++)
+            row[c] = ((inputSeed + i) * 37 + c * 11) % 1000;                  //Spread enough to move every minimum and maximum
+
+        records.appendRow(row, inputFirstTime + i * inputSpacing);
+    }
+}
+
+static bool sameRollup(const SensorRollup &synced, const SensorRollup &rebuilt)
+{
+    if(synced.count() != rebuilt.count())
+        return false;
+
+    for(int bucket = 0; bucket < rebuilt.count(); bucket++)
+    {
+        if(synced.startTime(bucket) != rebuilt.startTime(bucket))
+            return false;
+
+        for(int c = 0; c < SensorRecords::ChannelCount; c++)
+        {
+            SensorRecords::Channel channel = (SensorRecords::Channel)c;
+
+            if(synced.minimum(bucket, channel) != rebuilt.minimum(bucket, channel) ||
+               synced.maximum(bucket, channel) != rebuilt.maximum(bucket, channel) ||
+               synced.mean(bucket, channel) != rebuilt.mean(bucket, channel))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+
+
+/*          Class Declarations          */
+class TestSensorRollup : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void bucketsFollowRowTimes();
+    void resyncAfterTruncate_data();
+    void resyncAfterTruncate();
+};
+
+
+
+/*              Test Slots                      */
+void TestSensorRollup::bucketsFollowRowTimes()
+{
+    static const int spacing[] = {15, 45, 600, 120, 300, 15, 1500};        //Seconds between readings, a gap of more than a bucket included
+    static const int bucketSeconds = 600;
+
+    SensorRecords records;
+    double time = firstRowTime;
+
+    for(int i = 0; i < 40; i++)
+    {
+        appendRows(records, 1, i, time, 0);
+        time += spacing[i % 7];
+    }
+
+    SensorRollup rollup(bucketSeconds);
+    rollup.sync(records, 0);
+
+    int row = 0;
+
+    for(int bucket = 0; bucket < rollup.count(); bucket++)
+    {
+        double start = rollup.startTime(bucket);
+        double sum = 0;
+        int rows = 0;
+
+        QCOMPARE(std::fmod(start, bucketSeconds), 0.0);
+        QVERIFY(bucket == 0 || start > rollup.startTime(bucket - 1));
+
+        for(; row < records.count() && records.recordedAt(row) < start + bucketSeconds; row++, rows++)
+        {
+            QVERIFY(records.recordedAt(row) >= start);
+            sum += records.value(row, SensorRecords::SoilMoisture);
+        }
+
+        QVERIFY(rows > 0);                                                    //Spans without readings get no bucket
+        QCOMPARE(rollup.mean(bucket, SensorRecords::SoilMoisture), sum / rows);
+    }
+
+    QCOMPARE(row, records.count());
+
+    QCOMPARE(rollup.firstBucketFrom(0), 0);
+    QCOMPARE(rollup.firstBucketFrom(rollup.startTime(1)), 1);
+    QCOMPARE(rollup.firstBucketFrom(rollup.startTime(1) - 1), 0);            //Still inside the first bucket
+    QCOMPARE(rollup.firstBucketFrom(time + bucketSeconds), rollup.count());
+}
+
+void TestSensorRollup::resyncAfterTruncate_data()
+{
+    QTest::addColumn<int>("bucketSeconds");
+    QTest::addColumn<int>("spacing");
+    QTest::addColumn<int>("confirmedCount");
+    QTest::addColumn<int>("liveRows");
+    QTest::addColumn<int>("fetchedRows");
+
+    QTest::newRow("mid bucket") << 600 << 60 << 25 << 3 << 4;
+    QTest::newRow("on a bucket boundary") << 600 << 60 << 20 << 3 << 4;
+    QTest::newRow("live rows crossed a boundary") << 600 << 60 << 18 << 5 << 2;
+    QTest::newRow("fetch longer than a bucket") << 600 << 45 << 12 << 2 << 16;
+    QTest::newRow("rows further apart than a bucket") << 600 << 900 << 10 << 2 << 5;
+}
+
+void TestSensorRollup::resyncAfterTruncate()
+{
+    QFETCH(int, bucketSeconds);
+    QFETCH(int, spacing);
+    QFETCH(int, confirmedCount);
+    QFETCH(int, liveRows);
+    QFETCH(int, fetchedRows);
+
+    SensorRecords history;
+    SensorRollup synced(bucketSeconds);
+    double resumeTime = firstRowTime + confirmedCount * spacing;
+
+    appendRows(history, confirmedCount, 0, firstRowTime, spacing);            //Rows from graph_data
+    synced.sync(history, 0);
+
+    for(int i = 0; i < liveRows; i++)                                         //Readings appended one at a time, stamped a little after the hub did
+    {
+        appendRows(history, 1, 500 + i, resumeTime + i * spacing + 7, 0);
+        synced.sync(history, history.count() - 1);
+    }
+
+    SensorRecords fetched;                                                    //Next fetch replaces the live rows
+    appendRows(fetched, fetchedRows, 900, resumeTime, spacing);
+
+    history.truncate(confirmedCount);
+    history.append(fetched);
+    synced.sync(history, confirmedCount);
+
+    SensorRollup rebuilt(bucketSeconds);
+    rebuilt.sync(history, 0);
+
+    QCOMPARE(history.count(), confirmedCount + fetchedRows);
+    QVERIFY(sameRollup(synced, rebuilt));
+}
+
+QTEST_GUILESS_MAIN(TestSensorRollup)
+
+#include "tst_sensorrollup.moc"
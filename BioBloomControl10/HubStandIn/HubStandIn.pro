@@ -0,0 +1,24 @@
+#-------------------------------------------------
+#
+# Local stand-in for the BioBloom hub, serves the hub's .php endpoints
+# from memory so the client can be run and tested without the Pi
+#
+#-------------------------------------------------
+
+QT       += core
+QT       += network
+QT       -= gui
+
+TARGET = HubStandIn
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+SOURCES += \
+        main.cpp \
+    hubstandinserver.cpp \
+
+HEADERS += \
+    hubstandinserver.h \
@@ -0,0 +1,653 @@
+/*                  Header File                 */
+#include "hubstandinserver.h"
+#include <QUrl>
+#include <QStringList>
+#include <QRandomGenerator>
+#include <QtEndian>
+#include <QTextStream>
+#include <QDateTime>
+#include <QDebug>
+
+static const int subscriptionHoldTime = 25000;          //Same hold as subscribe.php before an empty answer
+static const char* const binaryRecordsType = "application/x-biobloom-records";
+
+/*          Constructor          */
+HubStandInServer::HubStandInServer(QObject *parent) : QTcpServer(parent)
+{
+    generatorTimer = new QTimer(this);
+    generatorPot = 0;
+    storeFile = NULL;
+
+    responseLatency = 0;
+    latencyClock.start();
+    delayedResponseTimer = new QTimer(this);
+    delayedResponseTimer->setSingleShot(true);
+    delayedResponseTimer->setTimerType(Qt::PreciseTimer);
+
+    connect(generatorTimer, SIGNAL(timeout()), this, SLOT(generatorTimeoutSlot()));
+    connect(delayedResponseTimer, SIGNAL(timeout()), this, SLOT(delayedResponseSlot()));
+}
+
+
+
+/*              Class Methods                   */
+void HubStandInServer::addPot(QString inputMac, QString inputName, QString inputProfile)
+{
+    StandInPot pot;
+    pot.mac = inputMac;
+    pot.name = inputName;
+    pot.profile = inputProfile;
+
+    potTable.insert(inputMac, pot);
+    journalPot(pot);
+}
+
+void HubStandInServer::storeReading(QString inputMac, QVector<int> inputValues)
+{
+    if(!potTable.contains(inputMac) || inputValues.count() < 6)
+        return;
+
+    StandInPot& pot = potTable[inputMac];
+
+    SensorRow row;
+    row.dataNumber = pot.rows.isEmpty() ? 1 : pot.rows.last().dataNumber + 1;       //Numbered per pot from 1, like sensor_data.php
+    row.recordedAt = QDateTime::currentSecsSinceEpoch();
+    row.values = inputValues.mid(0, 6);
+
+    pot.rows.append(row);
+    journalRow(inputMac, row);
+
+    answerSubscriptions();
+}
+
+void HubStandInServer::storeSyntheticReading(QString inputMac)
+{
+    if(!potTable.contains(inputMac))
+        return;
+
+    //Values are stored in tenths like the pots send them; each new row wanders a little from the last
+    static const int lowest[6] = {0, 300, 200, 150, 0, 0};
+    static const int highest[6] = {1000, 700, 800, 300, 1000, 1000};
+    static const int step[6] = {40, 10, 15, 3, 5, 2};
+
+    QList<SensorRow>& rows = potTable[inputMac].rows;
+    QVector<int> values(6);
+
+    for(int i = 0; i < 6; i++)
+    {
+        int previous = rows.isEmpty() ? (lowest[i] + highest[i]) / 2 : rows.last().values[i];
+        int next = previous + QRandomGenerator::global()->bounded(2 * step[i] + 1) - step[i];
+
+        values[i] = qBound(lowest[i], next, highest[i]);
+    }
+
+    storeReading(inputMac, values);
+}
+
+void HubStandInServer::setGeneratorInterval(int inputInterval)
+{
+    if(inputInterval > 0)
+        generatorTimer->start(inputInterval);
+    else
+        generatorTimer->stop();
+}
+
+bool HubStandInServer::setStoreFile(QString inputPath)
+{
+    QFile replayFile(inputPath);
+
+    //Lines are "pot,mac,name,profile" and "row,mac,data_number,six values"; a later pot line for the same mac wins
+    if(replayFile.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        QTextStream replayStream(&replayFile);
+        replayStream.setCodec("UTF-8");                                     //Written as UTF-8 by journalPot()
+
+        while(!replayStream.atEnd())
+        {
+            QStringList fields = replayStream.readLine().split(",");
+
+            if(fields[0] == "pot" && fields.count() >= 4)
+            {
+                StandInPot& pot = potTable[fields[1]];
+                pot.mac = fields[1];
+                pot.name = fields[2];
+                pot.profile = fields[3];
+            }
+            else if(fields[0] == "row" && fields.count() >= 9 && potTable.contains(fields[1]))
+            {
+                SensorRow row;
+                row.dataNumber = fields[2].toInt();
+
+                for(int i = 3; i < 9; i++)
+                    row.values.append(fields[i].toInt());
+
+                row.recordedAt = fields.count() >= 10 ? fields[9].toLongLong() : 0;       //Journals from before rows were stamped
+
+                potTable[fields[1]].rows.append(row);
+            }
+        }
+
+        replayFile.close();
+    }
+
+    storeFile = new QFile(inputPath, this);
+
+    if(!storeFile->open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+    {
+        qWarning() << "Could not open store file" << inputPath << storeFile->errorString();
+        delete storeFile;
+        storeFile = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+void HubStandInServer::setResponseLatency(int inputLatency)
+{
+    responseLatency = qMax(0, inputLatency);
+}
+
+int HubStandInServer::getPotCount()
+{
+    return potTable.count();
+}
+
+void HubStandInServer::journalPot(StandInPot& inputPot)
+{
+    if(!storeFile)
+        return;
+
+    storeFile->write(("pot," + inputPot.mac + "," + inputPot.name + "," + inputPot.profile + "\n").toUtf8());
+    storeFile->flush();
+}
+
+void HubStandInServer::journalRow(QString inputMac, SensorRow& inputRow)
+{
+    if(!storeFile)
+        return;
+
+    QByteArray line = "row," + inputMac.toUtf8() + "," + QByteArray::number(inputRow.dataNumber);
+
+    for(int i = 0; i < 6; i++)
+        line += "," + QByteArray::number(inputRow.values[i]);
+
+    line += "," + QByteArray::number(inputRow.recordedAt);
+    storeFile->write(line + "\n");
+    storeFile->flush();
+}
+
+QByteArray HubStandInServer::commandEcho(QStringList inputValues, QString inputMac)
+{
+    //The control scripts echo their inputs, the connection banner and the pot's address before forwarding to it
+    QByteArray echo;
+
+    for(int i = 0; i < inputValues.count(); i++)
+        echo += inputValues[i].toUtf8() + "   ";
+
+    echo += "\nConnected successfully\t\t";
+
+    if(potTable.contains(inputMac))
+        echo += potTable[inputMac].localIp.toUtf8();
+
+    return echo;
+}
+
+void HubStandInServer::incomingConnection(qintptr socketDescriptor)
+{
+    QTcpSocket* socket = new QTcpSocket(this);
+    socket->setSocketDescriptor(socketDescriptor);
+
+    socketBuffer.insert(socket, QByteArray());
+
+    connect(socket, SIGNAL(readyRead()), this, SLOT(socketReadyReadSlot()));
+    connect(socket, SIGNAL(disconnected()), this, SLOT(socketDisconnectedSlot()));
+}
+
+void HubStandInServer::processBuffer(QTcpSocket* inputSocket)
+{
+    //Requests on one connection are answered strictly in order, nothing more is read while a long poll is parked
+    while(!isParked(inputSocket))
+    {
+        QByteArray& buffer = socketBuffer[inputSocket];
+
+        int headerEnd = buffer.indexOf("\r\n\r\n");
+
+        if(headerEnd < 0)
+            return;
+
+        QList<QByteArray> headerLines = buffer.left(headerEnd).split('\n');
+        QList<QByteArray> requestLine = headerLines[0].trimmed().split(' ');
+
+        int contentLength = 0;
+        bool binaryFlag = false;
+
+        for(int i = 1; i < headerLines.count(); i++)
+        {
+            QByteArray line = headerLines[i].trimmed();
+
+            if(line.toLower().startsWith("content-length:"))
+                contentLength = line.mid(15).trimmed().toInt();
+
+            if(line.toLower().startsWith("accept:") && line.contains(binaryRecordsType))
+                binaryFlag = true;
+        }
+
+        if(buffer.size() < headerEnd + 4 + contentLength)                  //Body still on its way
+            return;
+
+        QByteArray body = buffer.mid(headerEnd + 4, contentLength);
+        buffer.remove(0, headerEnd + 4 + contentLength);
+
+        if(requestLine.count() < 2)
+        {
+            sendResponse(inputSocket, QByteArray(), 400);
+            continue;
+        }
+
+        QByteArray target = requestLine[1];
+        int queryStart = target.indexOf('?');
+
+        QHash<QString, QString> form = parseForm(queryStart < 0 ? QByteArray() : target.mid(queryStart + 1));
+        QHash<QString, QString> bodyForm = parseForm(body);
+
+        for(QHash<QString, QString>::const_iterator i = bodyForm.constBegin(); i != bodyForm.constEnd(); ++i)
+            form.insert(i.key(), i.value());
+
+        QString path = QString::fromLatin1(queryStart < 0 ? target : target.left(queryStart));
+
+        handleRequest(inputSocket, path.section('/', -1), form, binaryFlag);
+    }
+}
+
+bool HubStandInServer::isParked(QTcpSocket* inputSocket)
+{
+    for(int i = 0; i < parkedSubscriptions.count(); i++)
+        if(parkedSubscriptions[i].socket == inputSocket)
+            return true;
+
+    return false;
+}
+
+void HubStandInServer::handleRequest(QTcpSocket* inputSocket, QString path, QHash<QString, QString> form, bool binaryFlag)
+{
+    QString mac = form.value("mac");
+    QByteArray body;
+    QList<SensorRow> records;                                               //Rows for the sensor endpoints, sent packed or as text
+    bool recordsFlag = false;
+    QByteArray extraHeaders;
+
+    if(path == "ribbon_boot.php")
+    {
+        for(QMap<QString, StandInPot>::iterator i = potTable.begin(); i != potTable.end(); ++i)
+            if(!i->name.isEmpty())
+                body += (i->mac + "," + i->profile + "," + i->name + ",").toUtf8();
+    }
+    else if(path == "return_macs.php")
+    {
+        for(QMap<QString, StandInPot>::iterator i = potTable.begin(); i != potTable.end(); ++i)
+            if(i->profile.isEmpty())
+                body += (i->mac + ",").toUtf8();
+    }
+    else if(path == "recent_entry.php" || path == "data_request.php")
+    {
+        if(path == "data_request.php")
+            storeSyntheticReading(mac);                                     //The real hub pokes the pot and waits for its post; here the pot answers instantly
+
+        if(potTable.contains(mac) && !potTable[mac].rows.isEmpty())
+        {
+            records.append(potTable[mac].rows.last());
+            extraHeaders = "X-Last-Data-Number: " + QByteArray::number(records.last().dataNumber) + "\r\n";
+        }
+
+        recordsFlag = true;
+    }
+    else if(path == "graph_data.php")
+    {
+        int since = form.value("since").toInt();
+
+        if(potTable.contains(mac))
+            for(int i = 0; i < potTable[mac].rows.count(); i++)
+                if(potTable[mac].rows[i].dataNumber > since)
+                    records.append(potTable[mac].rows[i]);
+
+        int lastSent = records.isEmpty() ? since : records.last().dataNumber;             //Where this reply stopped, as graph_data.php reports it
+        extraHeaders = "X-Last-Data-Number: " + QByteArray::number(lastSent) + "\r\n"
+                       "X-Record-Times: 1\r\n";
+        recordsFlag = true;
+    }
+    else if(path == "fleet_snapshot.php")
+    {
+        for(QMap<QString, StandInPot>::iterator i = potTable.begin(); i != potTable.end(); ++i)
+            if(!i->name.isEmpty() && !i->rows.isEmpty())
+                body += rowText(*i, i->rows.last(), true);
+    }
+    else if(path == "action_request.php")
+    {
+        QString actionID = form.value("id");
+
+        if(potTable.contains(mac))
+        {
+            potTable[mac].lastCommand = "action " + actionID;
+
+            if(actionID == "water" && !potTable[mac].rows.isEmpty())
+            {
+                //A watered pot reports wetter soil and a lower tank straight away
+                QVector<int> values = potTable[mac].rows.last().values;
+                values[2] = qMin(values[2] + 250, 800);
+                values[4] = qMax(values[4] - 50, 0);
+
+                storeReading(mac, values);
+            }
+        }
+
+        qDebug() << "Action" << actionID << "for" << mac;
+        body = commandEcho(QStringList() << mac << actionID, mac);
+    }
+    else if(path == "audio_request.php" || path == "volume_request.php" || path == "rgb_request.php")
+    {
+        QStringList values;
+        values << mac;
+
+        if(path == "audio_request.php")
+            values << form.value("track") << form.value("volume");
+        else if(path == "volume_request.php")
+            values << form.value("volume");
+        else
+            values << form.value("r") << form.value("g") << form.value("b");
+
+        if(potTable.contains(mac))
+            potTable[mac].lastCommand = path.section('.', 0, 0) + " " + values.mid(1).join(" ");
+
+        qDebug() << path << values.mid(1) << "for" << mac;
+        body = commandEcho(values, mac);
+    }
+    else if(path == "personalise_plant.php")
+    {
+        if(potTable.contains(mac))
+        {
+            StandInPot& pot = potTable[mac];
+            pot.name = form.value("name");
+            pot.profile = form.value("profile");
+
+            journalPot(pot);
+        }
+
+        body = (mac + "   " + form.value("profile") + "   " + form.value("name") + "   ").toUtf8() + "\nConnected successfully\t\t";
+    }
+    else if(path == "update_ip.php")
+    {
+        body = (mac + "   " + form.value("local") + "   " + form.value("vers") + "   ").toUtf8() + "\nConnected successfully\t\t";
+
+        if(!potTable.contains(mac))
+        {
+            addPot(mac, QString(), QString());
+            body += "New pot, adding to database\t\t";
+        }
+        else
+            body += "Pot exists, updating info\t\t";
+
+        potTable[mac].localIp = form.value("local");
+    }
+    else if(path == "sensor_data.php")
+    {
+        QVector<int> values;
+        values << form.value("light_level").toInt() << form.value("air_humidity").toInt()
+               << form.value("soil_moisture").toInt() << form.value("temperature").toInt()
+               << form.value("water_level").toInt() << form.value("battery_level").toInt();
+
+        storeReading(mac, values);
+    }
+    else if(path == "subscribe.php")
+    {
+        QStringList macs = form.value("macs").split(",", QString::SkipEmptyParts);
+        QStringList since = form.value("since").split(",");
+
+        ParkedSubscription subscription;
+        subscription.socket = inputSocket;
+
+        for(int i = 0; i < macs.count(); i++)
+            subscription.cursor.insert(macs[i], i < since.count() ? since[i].toInt() : 0);
+
+        body = newRows(subscription.cursor);
+
+        if(body.isEmpty() && !macs.isEmpty())
+        {
+            subscription.timeoutTimer = new QTimer(this);
+            subscription.timeoutTimer->setSingleShot(true);
+            connect(subscription.timeoutTimer, SIGNAL(timeout()), this, SLOT(subscriptionTimeoutSlot()));
+            subscription.timeoutTimer->start(subscriptionHoldTime);
+
+            parkedSubscriptions.append(subscription);
+            return;
+        }
+    }
+    else
+    {
+        sendResponse(inputSocket, QByteArray(), 404);
+        return;
+    }
+
+    if(recordsFlag && binaryFlag)
+    {
+        sendResponse(inputSocket, packedRows(records, path == "graph_data.php"), 200, binaryRecordsType, extraHeaders);
+        return;
+    }
+
+    if(recordsFlag)
+        for(int i = 0; i < records.count(); i++)
+        {
+            if(path == "graph_data.php")                                         //graph_data.php leads each row with recorded_at
+                body += QByteArray::number(records[i].recordedAt) + "," + rowText(potTable[mac], records[i], false) + ",";
+            else
+                body += rowText(potTable[mac], records[i], false);
+        }
+
+    sendResponse(inputSocket, body, 200, "text/html; charset=UTF-8", extraHeaders);
+}
+
+void HubStandInServer::sendResponse(QTcpSocket* inputSocket, QByteArray body, int status, QByteArray contentType, QByteArray extraHeaders)
+{
+    QByteArray response;
+    response += "HTTP/1.1 " + QByteArray::number(status) + (status == 200 ? " OK" : " Error") + "\r\n";
+    response += "Content-Type: " + contentType + "\r\n";
+    response += "Content-Length: " + QByteArray::number(body.size()) + "\r\n";
+    response += extraHeaders;
+    response += "Connection: keep-alive\r\n\r\n";
+    response += body;
+
+    if(responseLatency <= 0)
+    {
+        inputSocket->write(response);
+        return;
+    }
+
+    DelayedResponse delayed;
+    delayed.socket = inputSocket;
+    delayed.response = response;
+    delayed.due = latencyClock.elapsed() + responseLatency;
+
+    delayedResponses.append(delayed);
+
+    if(!delayedResponseTimer->isActive())
+        delayedResponseTimer->start(responseLatency);
+}
+
+QByteArray HubStandInServer::newRows(QHash<QString, int> cursor)
+{
+    QByteArray rows;
+
+    for(QHash<QString, int>::const_iterator i = cursor.constBegin(); i != cursor.constEnd(); ++i)
+    {
+        if(!potTable.contains(i.key()) || potTable[i.key()].rows.isEmpty())
+            continue;
+
+        StandInPot& pot = potTable[i.key()];
+
+        if(pot.rows.last().dataNumber > i.value())
+            rows += rowText(pot, pot.rows.last(), true);
+    }
+
+    return rows;
+}
+
+QByteArray HubStandInServer::rowText(StandInPot& inputPot, SensorRow& inputRow, bool withMac)
+{
+    QByteArray text;
+
+    if(withMac)
+        text += inputPot.mac.toUtf8() + "," + QByteArray::number(inputRow.dataNumber) + ",";
+
+    for(int i = 0; i < 6; i++)
+    {
+        text += QByteArray::number(inputRow.values[i]);
+
+        if(i < 5 || withMac)
+            text += ",";
+    }
+
+    return text;
+}
+
+QByteArray HubStandInServer::packedRows(QList<SensorRow> inputRows, bool withTimes)
+{
+    //Same layout as sensor_records.php: "BB", version 1, all six channels (and recorded_at), count,
+    //then per row the uint32 time if sent and int16 tenths
+    QByteArray packed(8 + inputRows.count() * (withTimes ? 16 : 12), 0);
+    uchar* bytes = reinterpret_cast<uchar*>(packed.data());
+
+    bytes[0] = 'B';
+    bytes[1] = 'B';
+    bytes[2] = 1;
+    bytes[3] = withTimes ? 0x7F : 0x3F;
+    qToLittleEndian<quint32>(inputRows.count(), bytes + 4);
+
+    uchar* record = bytes + 8;
+
+    for(int i = 0; i < inputRows.count(); i++)
+    {
+        if(withTimes)
+        {
+            qToLittleEndian<quint32>(inputRows[i].recordedAt, record);
+            record += 4;
+        }
+
+        for(int c = 0; c < 6; c++, record += 2)
+            qToLittleEndian<qint16>(inputRows[i].values[c], record);
+    }
+
+    return packed;
+}
+
+void HubStandInServer::answerSubscriptions()
+{
+    for(int i = parkedSubscriptions.count() - 1; i >= 0; i--)
+    {
+        QByteArray rows = newRows(parkedSubscriptions[i].cursor);
+
+        if(rows.isEmpty())
+            continue;
+
+        ParkedSubscription subscription = parkedSubscriptions.takeAt(i);
+        subscription.timeoutTimer->deleteLater();
+
+        sendResponse(subscription.socket, rows);
+        processBuffer(subscription.socket);                                 //Anything the client queued behind the poll
+    }
+}
+
+QHash<QString, QString> HubStandInServer::parseForm(QByteArray inputForm)
+{
+    QHash<QString, QString> form;
+    QList<QByteArray> pairs = inputForm.split('&');
+
+    for(int i = 0; i < pairs.count(); i++)
+    {
+        if(pairs[i].isEmpty())
+            continue;
+
+        int split = pairs[i].indexOf('=');
+        QByteArray key = split < 0 ? pairs[i] : pairs[i].left(split);
+        QByteArray value = split < 0 ? QByteArray() : pairs[i].mid(split + 1);
+
+        form.insert(QUrl::fromPercentEncoding(key.replace('+', ' ')),
+                    QUrl::fromPercentEncoding(value.replace('+', ' ')));
+    }
+
+    return form;
+}
+
+
+
+/*              Class Slots                     */
+void HubStandInServer::socketReadyReadSlot()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+
+    if(!socket)
+        return;
+
+    socketBuffer[socket] += socket->readAll();
+    processBuffer(socket);
+}
+
+void HubStandInServer::socketDisconnectedSlot()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+
+    for(int i = parkedSubscriptions.count() - 1; i >= 0; i--)
+    {
+        if(parkedSubscriptions[i].socket != socket)
+            continue;
+
+        parkedSubscriptions[i].timeoutTimer->deleteLater();
+        parkedSubscriptions.removeAt(i);
+    }
+
+    socketBuffer.remove(socket);
+    socket->deleteLater();
+}
+
+void HubStandInServer::generatorTimeoutSlot()
+{
+    if(potTable.isEmpty())
+        return;
+
+    //One pot per tick, round robin, so rows trickle in the way a real fleet's would
+    generatorPot = (generatorPot + 1) % potTable.count();
+    storeSyntheticReading((potTable.begin() + generatorPot).key());
+}
+
+void HubStandInServer::delayedResponseSlot()
+{
+    qint64 now = latencyClock.elapsed();
+
+    while(!delayedResponses.isEmpty() && delayedResponses.first().due <= now)
+    {
+        DelayedResponse delayed = delayedResponses.takeFirst();
+
+        if(delayed.socket)
+            delayed.socket->write(delayed.response);
+    }
+
+    if(!delayedResponses.isEmpty())
+        delayedResponseTimer->start((int)(delayedResponses.first().due - now));
+}
+
+void HubStandInServer::subscriptionTimeoutSlot()
+{
+    QTimer* timer = qobject_cast<QTimer*>(sender());
+
+    for(int i = 0; i < parkedSubscriptions.count(); i++)
+    {
+        if(parkedSubscriptions[i].timeoutTimer != timer)
+            continue;
+
+        ParkedSubscription subscription = parkedSubscriptions.takeAt(i);
+        subscription.timeoutTimer->deleteLater();
+
+        sendResponse(subscription.socket, QByteArray());                   //Nothing new, client simply asks again
+        processBuffer(subscription.socket);
+        return;
+    }
+}
@@ -0,0 +1,124 @@
+/*      Define Header File      */
+#ifndef HUBSTANDINSERVER_H
+#define HUBSTANDINSERVER_H
+
+/*      Library Classes         */
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QHash>
+#include <QMap>
+#include <QList>
+#include <QVector>
+#include <QString>
+#include <QStringList>
+#include <QByteArray>
+#include <QFile>
+#include <QPointer>
+#include <QElapsedTimer>
+
+/*
+ * Serves the hub's php endpoints over plain HTTP/1.1 from an in-memory pot
+ * table, so BioBloomControl can be pointed at it (--hub-url, BIOBLOOM_HUB_URL
+ * or hub/url in the settings) instead of the Pi. Connections are kept alive and requests on one socket
+ * are answered in order. subscribe.php is held open until a row newer than the
+ * client's cursor is stored, exactly like the real hub's long poll, and the
+ * sensor endpoints answer with packed binary rows when the client asks.
+ * Pot commands are logged and echoed the way the php scripts echo them. With a
+ * store file every new pot, rename and row is appended to it as a line of text
+ * and replayed on the next start, so a fleet's history survives restarts.
+ * A response latency holds every answer back by that long, in order, to
+ * stand in for a slow hub or network when benchmarking the client.
+ */
+
+/*          Class Declarations          */
+class HubStandInServer : public QTcpServer
+{
+    Q_OBJECT
+
+public:
+    explicit HubStandInServer(QObject *parent = nullptr);
+
+    void addPot(QString inputMac, QString inputName, QString inputProfile);
+    void storeReading(QString inputMac, QVector<int> inputValues);        //Light, humidity, moisture, temperature, water, battery
+    void storeSyntheticReading(QString inputMac);
+
+    void setGeneratorInterval(int inputInterval);                          //Milliseconds between synthetic rows, 0 turns it off
+    bool setStoreFile(QString inputPath);                                  //Replays the file, then appends every change to it
+    void setResponseLatency(int inputLatency);                             //Milliseconds added to every answer
+    int getPotCount();
+
+protected:
+    void incomingConnection(qintptr socketDescriptor) override;
+
+private slots:
+    void socketReadyReadSlot();
+    void socketDisconnectedSlot();
+    void generatorTimeoutSlot();
+    void subscriptionTimeoutSlot();
+    void delayedResponseSlot();
+
+private:
+    struct SensorRow
+    {
+        int dataNumber;
+        qint64 recordedAt;                                      //Seconds since the epoch, like sensor_data.recorded_at
+        QVector<int> values;
+    };
+
+    struct StandInPot
+    {
+        QString mac;
+        QString name;
+        QString profile;
+        QString localIp;                                //As last posted to update_ip.php
+        QString lastCommand;                            //Newest action, audio, volume or rgb request
+        QList<SensorRow> rows;
+    };
+
+    struct ParkedSubscription
+    {
+        QTcpSocket* socket;
+        QHash<QString, int> cursor;                    //MAC -> newest data_number the client has
+        QTimer* timeoutTimer;
+    };
+
+    struct DelayedResponse
+    {
+        QPointer<QTcpSocket> socket;                    //Cleared if the client hangs up first
+        QByteArray response;
+        qint64 due;                                     //On latencyClock
+    };
+
+    QMap<QString, StandInPot> potTable;                 //MAC -> pot, ordered so replies are stable
+    QHash<QTcpSocket*, QByteArray> socketBuffer;         //Bytes received but not yet parsed into a request
+    QList<ParkedSubscription> parkedSubscriptions;
+
+    QTimer* generatorTimer;
+    int generatorPot;
+
+    QFile* storeFile;                                    //Open for appending once replayed, NULL without a store
+
+    int responseLatency;
+    QElapsedTimer latencyClock;
+    QList<DelayedResponse> delayedResponses;             //Oldest first, every one waits the same time so they stay in order
+    QTimer* delayedResponseTimer;
+
+    void processBuffer(QTcpSocket* inputSocket);
+    bool isParked(QTcpSocket* inputSocket);
+    void handleRequest(QTcpSocket* inputSocket, QString path, QHash<QString, QString> form, bool binaryFlag);
+    void sendResponse(QTcpSocket* inputSocket, QByteArray body, int status = 200, QByteArray contentType = "text/html; charset=UTF-8", QByteArray extraHeaders = QByteArray());
+
+    QByteArray newRows(QHash<QString, int> cursor);
+    QByteArray rowText(StandInPot& inputPot, SensorRow& inputRow, bool withMac);
+    QByteArray packedRows(QList<SensorRow> inputRows, bool withTimes);
+    void answerSubscriptions();
+
+    void journalPot(StandInPot& inputPot);
+    void journalRow(QString inputMac, SensorRow& inputRow);
+    QByteArray commandEcho(QStringList inputValues, QString inputMac);
+
+    static QHash<QString, QString> parseForm(QByteArray inputForm);
+};
+
+#endif // HUBSTANDINSERVER_H
@@ -0,0 +1,57 @@
+#include "hubstandinserver.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QHostAddress>
+#include <QDebug>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    a.setApplicationName("HubStandIn");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Serves the BioBloom hub endpoints from memory for testing the client");
+    parser.addHelpOption();
+
+    QCommandLineOption portOption("port", "Port to listen on.", "port", "8080");
+    QCommandLineOption potsOption("pots", "Number of named pots to create.", "count", "4");
+    QCommandLineOption intervalOption("interval", "Milliseconds between synthetic sensor rows, 0 for none.", "ms", "2000");
+    QCommandLineOption storeOption("store", "File the pots and their rows are kept in between runs.", "file");
+    QCommandLineOption latencyOption("latency", "Milliseconds every answer is held back, to stand in for a slow hub.", "ms", "0");
+    parser.addOption(portOption);
+    parser.addOption(potsOption);
+    parser.addOption(intervalOption);
+    parser.addOption(storeOption);
+    parser.addOption(latencyOption);
+    parser.process(a);
+
+    HubStandInServer server;
+
+    if(parser.isSet(storeOption) && !server.setStoreFile(parser.value(storeOption)))
+        return 1;
+
+    int potCount = parser.value(potsOption).toInt();
+    bool freshFlag = server.getPotCount() == 0;                                 //A replayed store already has its pots
+
+    for(int i = 0; freshFlag && i < potCount; i++)
+    {
+        QString mac = QString("5C:CF:7F:00:%1:%2").arg((i >> 8) & 0xFF, 2, 16, QChar('0'))
+                                                   .arg(i & 0xFF, 2, 16, QChar('0')).toUpper();
+
+        server.addPot(mac, QString("Plant %1").arg(i + 1), "Spider Plant");
+        server.storeSyntheticReading(mac);
+    }
+
+    server.setGeneratorInterval(parser.value(intervalOption).toInt());
+    server.setResponseLatency(parser.value(latencyOption).toInt());
+
+    if(!server.listen(QHostAddress::Any, parser.value(portOption).toUShort()))
+    {
+        qCritical() << "Could not listen:" << server.errorString();
+        return 1;
+    }
+
+    qDebug() << "Hub stand-in listening on port" << server.serverPort() << "with" << server.getPotCount() << "pots";
+
+    return a.exec();
+}
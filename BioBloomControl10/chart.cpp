@@ -1,8 +1,11 @@
 #include "chart.h"
+#include "metricsregistry.h"
+#include "tracerecorder.h"
 #include <QtCharts>
 #include <QtCore/QRandomGenerator>
 #include <QtCore/QDebug>
 #include <cmath>
+#include <algorithm>
 
 Chart::Chart(QString desiredType)
    {
@@ -11,6 +14,11 @@ Chart::Chart(QString desiredType)
     axisY = new QValueAxis;
     axisX = new QDateTimeAxis;
 
+    rawSortedFlag=true;
+    redrawTimer = new QTimer(this);
+    redrawTimer->setSingleShot(true);
+    connect(redrawTimer, SIGNAL(timeout()), this, SLOT(redrawSlot()));
+
     data_series = new QLineSeries(this);
     idealSeries = new QLineSeries(this);
     addSeries(data_series);
@@ -73,12 +81,11 @@ Chart::Chart(QString desiredType)
 
 void Chart::addPoint(qint64 dataNumber, int dataValue)//this adds a point to the chart
 {
-    data_series->append(dataNumber, dataValue/10);
+    if(!rawPoints.isEmpty() && dataNumber < rawPoints.last().x())
+        rawSortedFlag=false;
+    rawPoints.append(QPointF(dataNumber, dataValue/10));
+    scheduleRedraw();
 
-    if(idealValue!=100000){
-    idealSeries->append(axisX->min().toMSecsSinceEpoch(), idealValue);   //data_series->pointsVector().first().x(), idealValue);
-    idealSeries->append(data_series->pointsVector().last().x(), idealValue);
-    }
     axisX->setMax(QDateTime().currentDateTime());
     /*setYmax();
     printf("finishedYmax");
@@ -88,6 +95,143 @@ void Chart::addPoint(qint64 dataNumber, int dataValue)//this adds a point to the
 }
 
 
+void Chart::setPoints(const QVector<QPointF> &points)//bulk load: swaps in a whole history at once instead of a point at a time
+{
+    rawPoints.resize(points.count());
+    rawSortedFlag=true;
+
+    for(int i=0; i<points.count(); i++)
+    {
+        rawPoints[i]=QPointF(points[i].x(), (int)points[i].y()/10);//same scaling as addPoint
+        if(i > 0 && points[i].x() < points[i-1].x())
+            rawSortedFlag=false;
+    }
+
+    QChart::AnimationOptions animations=animationOptions();
+    setAnimationOptions(QChart::NoAnimation);//animating thousands of new points is what froze the window
+
+    axisX->setMax(QDateTime().currentDateTime());
+    redrawTimer->stop();
+    redrawSlot();
+
+    setAnimationOptions(animations);
+}
+
+
+void Chart::clearPoints()//removes every point so the chart can be redrawn from the unit's history
+{
+    rawPoints.clear();
+    rawSortedFlag=true;
+    data_series->clear();
+}
+
+
+void Chart::updateIdealLine()//the ideal is a constant, two points across the visible range are all it needs
+{
+    if(idealValue==100000)
+    {
+        idealSeries->clear();
+        return;
+    }
+
+    QVector<QPointF> ends;
+    ends.append(QPointF(axisX->min().toMSecsSinceEpoch(), idealValue));
+    ends.append(QPointF(axisX->max().toMSecsSinceEpoch(), idealValue));
+    idealSeries->replace(ends);
+}
+
+
+void Chart::scheduleRedraw()
+{
+    if(!redrawTimer->isActive())
+        redrawTimer->start(0);
+}
+
+
+void Chart::resizeEvent(QGraphicsSceneResizeEvent *event)//more or fewer pixels means a different number of points is worth drawing
+{
+    QChart::resizeEvent(event);
+    scheduleRedraw();
+}
+
+
+void Chart::redrawSlot()
+{
+    TraceSpan span("chart redraw", "ui");
+
+    QElapsedTimer redrawClock;
+    redrawClock.start();
+
+    if(!rawSortedFlag)
+    {
+        std::sort(rawPoints.begin(), rawPoints.end(), [](const QPointF &a, const QPointF &b) { return a.x() < b.x(); });
+        rawSortedFlag=true;
+    }
+
+    double minX=axisX->min().toMSecsSinceEpoch();
+    double maxX=axisX->max().toMSecsSinceEpoch();
+    double pixels=plotArea().width() > 0 ? plotArea().width() : size().width();//plot area is empty until the first layout
+    int buckets=qMax(1, (int)pixels);//one min/max pair per horizontal pixel
+
+    //only the visible samples plus one either side, so the line still runs off the edges
+    auto before=std::lower_bound(rawPoints.constBegin(), rawPoints.constEnd(), minX, [](const QPointF &p, double x) { return p.x() < x; });
+    auto after=std::upper_bound(rawPoints.constBegin(), rawPoints.constEnd(), maxX, [](double x, const QPointF &p) { return x < p.x(); });
+    int first=qMax(0, (int)(before - rawPoints.constBegin()) - 1);
+    int last=qMin(rawPoints.count(), (int)(after - rawPoints.constBegin()) + 1);
+
+    updateIdealLine();
+
+    if(last - first <= 2*buckets)
+        data_series->replace(rawPoints.mid(first, last - first));//few enough to draw every one
+    else
+        data_series->replace(decimate(first, last, minX, maxX, buckets));
+
+    MetricsRegistry::instance()->record("ui.chartRedrawMs", redrawClock.nsecsElapsed() / 1e6);
+}
+
+
+QVector<QPointF> Chart::decimate(int first, int last, double minX, double maxX, int buckets)
+{
+    //min/max envelope: the lowest and highest sample of every pixel column, in time order, so spikes stay visible
+    QVector<QPointF> envelope;
+    envelope.reserve(2*buckets + 2);
+
+    double bucketWidth=(maxX - minX)/buckets;
+    int i=first;
+
+    while(i < last)
+    {
+        double x=rawPoints[i].x();
+
+        if(x < minX || x > maxX || bucketWidth <= 0)//the edge points are kept as they are
+        {
+            envelope.append(rawPoints[i]);
+            i++;
+            continue;
+        }
+
+        int bucket=qMin(buckets - 1, (int)((x - minX)/bucketWidth));
+        double bucketEnd=minX + (bucket + 1)*bucketWidth;
+        int lowest=i;
+        int highest=i;
+
+        for(i++; i < last && rawPoints[i].x() < bucketEnd && rawPoints[i].x() <= maxX; i++)
+        {
+            if(rawPoints[i].y() < rawPoints[lowest].y())
+                lowest=i;
+            if(rawPoints[i].y() > rawPoints[highest].y())
+                highest=i;
+        }
+
+        envelope.append(rawPoints[qMin(lowest, highest)]);
+        if(lowest != highest)
+            envelope.append(rawPoints[qMax(lowest, highest)]);
+    }
+
+    return envelope;
+}
+
+
 Chart::~Chart()//destructor
 {
 
@@ -95,22 +239,21 @@ Chart::~Chart()//destructor
 void Chart::setIdeal(float ideal)
 {
     idealValue=ideal;
+    updateIdealLine();
 }
 
 
 
 void Chart::rangeSignal(QString desiredstart) //change the range being viewed appropriately
 {
+    scheduleRedraw();//the new range gets its own set of points
+
     if(desiredstart=="a day ago")
     {
         axisX->setRange(QDateTime().currentDateTime().addDays(-1), QDateTime().currentDateTime());
         axisX->setTitleText("Time received");
         axisX->setFormat("hh:mm");
         axisX->setTickCount(5);
-        if(idealValue!=100000){
-        idealSeries->remove(idealSeries->pointsVector().first().x(), idealValue);//remove useless points
-        idealSeries->append(axisX->min().toMSecsSinceEpoch(), idealValue);
-    }
 
 
     }
@@ -120,24 +263,30 @@ void Chart::rangeSignal(QString desiredstart) //change the range being viewed ap
         axisX->setTitleText("Date received");
         axisX->setFormat("ddd:hh:mm");
         axisX->setTickCount(3);
-        if(idealValue!=100000){
-        idealSeries->remove(idealSeries->pointsVector().first().x(), idealValue);//remove useless points
-        idealSeries->append(axisX->min().toMSecsSinceEpoch(), idealValue);
-        }
 
 
     }
 
+    else if(desiredstart=="a month ago")
+    {
+        axisX->setRange(QDateTime().currentDateTime().addMonths(-1), QDateTime().currentDateTime());
+        axisX->setTitleText("Date received");
+        axisX->setFormat("dd MMM");
+        axisX->setTickCount(5);
+    }
+    else if(desiredstart=="a year ago")
+    {
+        axisX->setRange(QDateTime().currentDateTime().addYears(-1), QDateTime().currentDateTime());
+        axisX->setTitleText("Date received");
+        axisX->setFormat("MMM yy");
+        axisX->setTickCount(5);
+    }
     else if(desiredstart=="an hour ago")
     {
         axisX->setRange(QDateTime().currentDateTime().addSecs(-3600), QDateTime().currentDateTime());
         axisX->setTitleText("Time received");
         axisX->setFormat("ddd:hh:mm");
         axisX->setTickCount(5);
-        if(idealValue!=100000){
-        idealSeries->remove(idealSeries->pointsVector().first().x(), idealValue);//remove useless points
-        idealSeries->append(axisX->min().toMSecsSinceEpoch(), idealValue);
-        }
     }
 
 
@@ -12,6 +12,8 @@ public:
     ~Chart();
 
     void addPoint(qint64 dataNumber, int dataValue);//int dataNumber
+    void setPoints(const QVector<QPointF> &points);//x in msecs, y in raw tenths like addPoint
+    void clearPoints();
     void setIdeal(float ideal);
     void setYmax();
     void setYmin();
@@ -19,8 +21,20 @@ public:
 
 public slots:
     void rangeSignal(QString desiredstart);
+    void redrawSlot();//rebuilds data_series from rawPoints for the current range and width
+
+protected:
+    void resizeEvent(QGraphicsSceneResizeEvent *event) override;
 
 private:
+    QVector<QPointF> rawPoints;//every sample added, data_series only holds what is worth drawing
+    bool rawSortedFlag;
+    QTimer *redrawTimer;//coalesces redraws so a burst of addPoint calls costs one pass
+
+    void scheduleRedraw();
+    void updateIdealLine();
+    QVector<QPointF> decimate(int first, int last, double minX, double maxX, int buckets);
+
     QLineSeries *data_series;
     QLineSeries *idealSeries;
     QValueAxis *axisY;
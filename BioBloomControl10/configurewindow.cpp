@@ -10,7 +10,7 @@ ConfigureWindow::ConfigureWindow(BioBloomUnit* inputParentUnit, QWidget *parent)
     WindowPalette.setColor(QPalette::Background, Qt::white);                                       //Configure the palette to fill the background with white
     this->setPalette(WindowPalette);                                                              //Set the palette
 
-    setupPlantProfiles();
+    newPlantProfile = PlantProfileCatalog::instance()->defaultProfile();
     setupComboBox();
 
     connect(ui->BackButton, SIGNAL(released()), this, SLOT(backButtonPressSlot()) );
@@ -30,46 +30,12 @@ void ConfigureWindow::applyButtonPressSlot()
     parentUnitAddress->setPlantName(ui->lineEdit->text());
     parentUnitAddress->setPlantProfileTemplate(newPlantProfile);
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/personalise_plant.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postValue = parentUnitAddress->getMacAddress();
-    QString postKey2 = "name";
-    QString postValue2 = newPlantName;
-    QString postKey3 = "profile";
-    QString postValue3 = newPlantProfile->plantTypeName;
-
-    postData.append(postKey).append("=").append(postValue).append("&").append(postKey2).append("=").append(postValue2).append("&").append(postKey3).append("=").append(postValue3).append("&");
-    manager->post(request,postData);
+    HubClient::instance()->personalisePlant(parentUnitAddress->getMacAddress(), newPlantName, newPlantProfile->plantTypeName);
 }
 
 void ConfigureWindow::plantTypeSelectionSlot(QString inputPlantType)
 {
-    if(inputPlantType == "Default")
-        newPlantProfile = plantProfile[0];
-
-    else if(inputPlantType == "Aloe Cactus")
-        newPlantProfile = plantProfile[1];
-
-    else if(inputPlantType == "Spider Plant")
-        newPlantProfile = plantProfile[2];
-
-    else if(inputPlantType == "Peace Lily")
-        newPlantProfile = plantProfile[3];
-
-    else if(inputPlantType == "Venus Fly Trap")
-        newPlantProfile = plantProfile[4];
-    else
-        newPlantProfile = plantProfile[0];
+    newPlantProfile = PlantProfileCatalog::instance()->profile(inputPlantType);             //Default for the placeholder entry
 }
 
 void ConfigureWindow::backButtonPressSlot()
@@ -78,32 +44,10 @@ void ConfigureWindow::backButtonPressSlot()
 }
 
 /*                  Class Methods                   */
-void ConfigureWindow::setupPlantProfiles()
-{
-    /*      Default     */
-    plantProfile.append(new PlantProfile("Default",24,70,60,45));
-
-    /*      Cactus      */
-    plantProfile.append(new PlantProfile("Aloe Cactus",26,65,35,45));
-
-    /*   Spider Plant   */
-    plantProfile.append(new PlantProfile("Spider Plant",22,65,60,45));
-
-    /*    Peace Lily    */
-    plantProfile.append(new PlantProfile("Peace Lily",24,65,60,50));
-
-    /*  Venus Fly Trap  */
-    plantProfile.append(new PlantProfile("Venus Fly Trap",27,65,75,60));
-}
-
 void ConfigureWindow::setupComboBox()
 {
     ui->PlantTypeList->addItem("Please select a plant type");
-    ui->PlantTypeList->addItem("Default");
-    ui->PlantTypeList->addItem("Aloe Cactus");
-    ui->PlantTypeList->addItem("Spider Plant");
-    ui->PlantTypeList->addItem("Peace Lily");
-    ui->PlantTypeList->addItem("Venus Fly Trap");
+    ui->PlantTypeList->addItems(PlantProfileCatalog::instance()->profileNames());           //Built-in and custom species
 
     QObject::connect(ui->PlantTypeList, SIGNAL(currentIndexChanged(QString)), this, SLOT(plantTypeSelectionSlot(QString)));
 
@@ -2,10 +2,11 @@
 #define CONFIGUREWINDOW_H
 
 #include <QWidget>
-#include <QNetworkAccessManager>
 
 #include "biobloomunit.h"
 #include "plantprofile.h"
+#include "plantprofilecatalog.h"
+#include "hubclient.h"
 
 namespace Ui {class ConfigureWindow;}
 
@@ -20,11 +21,9 @@ public:
 
     Ui::ConfigureWindow *ui;
 
-    QVector<PlantProfile*> plantProfile;
-
     QString unitMacAddress;
     QString newPlantName;
-    PlantProfile* newPlantProfile;
+    PlantProfilePointer newPlantProfile;
 
 
 public slots:
@@ -36,7 +35,6 @@ private:                                                //POSSIBLE IMAGES - NOT
     BioBloomUnit* parentUnitAddress;
 
     void setupComboBox();
-    void setupPlantProfiles();
     void updateDatabase();
 
 };
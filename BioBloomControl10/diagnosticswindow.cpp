@@ -0,0 +1,158 @@
+/*                  Header File                 */
+#include "diagnosticswindow.h"
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QFileDialog>
+
+/*               Class Constructor              */
+DiagnosticsWindow::DiagnosticsWindow(QWidget *parent) : QWidget(parent)
+{
+    setWindowTitle("Diagnostics");
+    resize(720, 480);
+
+    QPalette WindowPalette;                                                                     //Create a palette
+    WindowPalette.setColor(QPalette::Background, Qt::white);                                   //Configure the palette to fill the background with white
+    this->setPalette(WindowPalette);                                                          //Set the palette
+
+    summaryLabel = new QLabel(this);
+
+    metricTable = new QTableWidget(0, 6, this);
+    metricTable->setHorizontalHeaderLabels(QStringList() << "Metric" << "Value" << "Rate /s" << "p50 ms" << "p99 ms" << "Max ms");
+    metricTable->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
+    metricTable->verticalHeader()->hide();
+    metricTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+    saveButton = new QPushButton("Save JSON", this);
+    backButton = new QPushButton("Back", this);
+
+    QHBoxLayout* buttonLayout = new QHBoxLayout;
+    buttonLayout->addWidget(summaryLabel, 1);
+    buttonLayout->addWidget(saveButton);
+    buttonLayout->addWidget(backButton);
+
+    QVBoxLayout* windowLayout = new QVBoxLayout(this);
+    windowLayout->addLayout(buttonLayout);
+    windowLayout->addWidget(metricTable);
+
+    refreshTimer = new QTimer(this);
+    refreshTimer->setInterval(1000);
+
+    connect(refreshTimer, SIGNAL(timeout()), this, SLOT(refreshSlot()));
+    connect(saveButton, SIGNAL(released()), this, SLOT(saveButtonPressSlot()));
+    connect(backButton, SIGNAL(released()), this, SLOT(backButtonPressSlot()));
+}
+
+
+
+/*               Class Slots                    */
+void DiagnosticsWindow::refreshSlot()
+{
+    MetricsRegistry* registry = MetricsRegistry::instance();
+
+    QStringList counters = registry->counterNames();
+    QStringList gauges = registry->gaugeNames();
+    QStringList histograms = registry->histogramNames();
+
+    double interval = 0;                                                          //No rates on the first refresh after opening
+
+    if(refreshClock.isValid())
+        interval = qMax(0.001, refreshClock.restart() / 1000.0);
+    else
+        refreshClock.start();
+
+    metricTable->setRowCount(counters.count() + gauges.count() + histograms.count());
+    int row = 0;
+
+    for(int i = 0; i < counters.count(); i++)
+    {
+        qint64 value = registry->counter(counters[i]);
+        QString rate = (interval > 0) ? QString::number((value - previousCounter.value(counters[i])) / interval, 'f', 1) : QString();
+
+        previousCounter.insert(counters[i], value);
+        setRow(row++, counters[i], QString::number(value), rate, QString(), QString(), QString());
+    }
+
+    for(int i = 0; i < gauges.count(); i++)
+        setRow(row++, gauges[i], QString::number(registry->gauge(gauges[i])), QString(), QString(), QString(), QString());
+
+    for(int i = 0; i < histograms.count(); i++)
+    {
+        LatencyHistogram histogram = registry->histogram(histograms[i]);
+
+        setRow(row++, histograms[i], QString::number(histogram.count()), QString(),
+               QString::number(histogram.percentile(0.5), 'f', 1),
+               QString::number(histogram.percentile(0.99), 'f', 1),
+               QString::number(histogram.maximum(), 'f', 1));
+    }
+
+    QHash<QString, double> ages = registry->unitAgeSeconds();
+    QString oldestUnit;
+    double oldestAge = 0;
+
+    QHash<QString, double>::const_iterator i;
+    for(i = ages.constBegin(); i != ages.constEnd(); ++i)
+        if(i.value() >= oldestAge)
+        {
+            oldestAge = i.value();
+            oldestUnit = i.key();
+        }
+
+    summaryLabel->setText(QString("Up %1 s, %2 units heard from, oldest %3 (%4 s ago)")
+                          .arg(registry->uptimeSeconds(), 0, 'f', 0)
+                          .arg(ages.count())
+                          .arg(oldestUnit.isEmpty() ? QString("none") : oldestUnit)
+                          .arg(oldestAge, 0, 'f', 0));
+}
+
+void DiagnosticsWindow::saveButtonPressSlot()
+{
+    QString path = QFileDialog::getSaveFileName(this, "Save metrics", "metrics.json", "JSON (*.json)");
+
+    if(!path.isEmpty())
+        MetricsRegistry::instance()->writeJson(path);
+}
+
+void DiagnosticsWindow::backButtonPressSlot()
+{
+    this->close();
+}
+
+
+
+/*              Class Methods                   */
+void DiagnosticsWindow::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+
+    refreshSlot();
+    refreshTimer->start();
+}
+
+void DiagnosticsWindow::hideEvent(QHideEvent *event)
+{
+    QWidget::hideEvent(event);
+
+    refreshTimer->stop();                                                         //Costs nothing while closed
+    refreshClock.invalidate();
+    previousCounter.clear();
+}
+
+void DiagnosticsWindow::setRow(int row, const QString& name, const QString& value, const QString& rate,
+                               const QString& p50, const QString& p99, const QString& maximum)
+{
+    QStringList cells = QStringList() << name << value << rate << p50 << p99 << maximum;
+
+    for(int column = 0; column < cells.count(); column++)
+    {
+        QTableWidgetItem* cell = metricTable->item(row, column);
+
+        if(!cell)
+        {
+            cell = new QTableWidgetItem;
+            metricTable->setItem(row, column, cell);
+        }
+
+        cell->setText(cells[column]);
+    }
+}
@@ -0,0 +1,52 @@
+/*      Define Header File      */
+#ifndef DIAGNOSTICSWINDOW_H
+#define DIAGNOSTICSWINDOW_H
+
+/*      Library Classes         */
+#include <QWidget>
+#include <QTimer>
+#include <QLabel>
+#include <QTableWidget>
+#include <QPushButton>
+#include <QHash>
+
+#include "metricsregistry.h"
+
+/*
+ * Live view of the MetricsRegistry, refreshed every second while it is open.
+ * Counter rates are over the last refresh rather than since start. Save writes
+ * the registry's JSON document.
+ */
+
+/*          Class Declarations          */
+class DiagnosticsWindow : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit DiagnosticsWindow(QWidget *parent = 0);
+
+public slots:
+    void refreshSlot();
+    void saveButtonPressSlot();
+    void backButtonPressSlot();
+
+protected:
+    void showEvent(QShowEvent *event) override;
+    void hideEvent(QHideEvent *event) override;
+
+private:
+    QLabel* summaryLabel;
+    QTableWidget* metricTable;
+    QPushButton* saveButton;
+    QPushButton* backButton;
+    QTimer* refreshTimer;
+
+    QHash<QString, qint64> previousCounter;                     //Counter values at the last refresh
+    QElapsedTimer refreshClock;
+
+    void setRow(int row, const QString& name, const QString& value, const QString& rate,
+                const QString& p50, const QString& p99, const QString& maximum);
+};
+
+#endif // DIAGNOSTICSWINDOW_H
@@ -1,4 +1,9 @@
 #include "GraphDisplay.h"
+#include "metricsregistry.h"
+#include "tracerecorder.h"
+#include <QElapsedTimer>
+
+static const int maximumPlotPoints = 1000;                                      //Above this a range is drawn from a rollup instead of raw rows
 
 GraphDisplay::GraphDisplay(QString graphType, QWidget *parent) : QWidget(parent)
 {   //initialise members
@@ -13,38 +18,26 @@ GraphDisplay::GraphDisplay(QString graphType, QWidget *parent) : QWidget(parent)
     menu->addItem("an hour ago");
     menu->addItem("a day ago");
     menu->addItem("a week ago");
+    menu->addItem("a month ago");
+    menu->addItem("a year ago");
     chart->legend()->hide();
     chart->setAnimationOptions(QChart::AllAnimations);
 
     QObject::connect(menu,SIGNAL(currentIndexChanged(QString)),chart,SLOT(rangeSignal(QString)));
+    QObject::connect(menu,SIGNAL(currentIndexChanged(QString)),this,SLOT(rangeChangedSlot(QString)));
+    visibleSeconds=0;
     menu->show();
     graphView->show();
     //data read intialise stuff
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
     qDebug() <<"90";
-    
-       connect(manager, SIGNAL(finished(QNetworkReply*)),
-               this, SLOT(graphDataFetchFinished(QNetworkReply*)));
-
-       QUrl url;
-       QByteArray postData;
-       url.setUrl("http://192.168.5.1:80/graph_data.php");
-       QNetworkRequest request(url);
-       request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-       
     qDebug() << macAddress;
-    
-       QString postKey = "mac";
-       QString postValue = macAddress; //GET JOE TO PASS THE MAC ADDRESS ID FOR THE RIGHT PLANT TO HERE
-                               // CAN GET HIM TO DO IT TOMORROW
-    qDebug() << "91";
-       postData.append(postKey).append("=").append(postValue).append("&");
-       manager->post(request,postData);
+
+    historyAddress = NULL;                                                      //No unit to read from
 
 
 }
 
-GraphDisplay::GraphDisplay(QString graphType, int ideal, QString inputMacAddress, QWidget *parent): QWidget(parent)
+GraphDisplay::GraphDisplay(QString graphType, int ideal, UnitHistory* inputHistory, QWidget *parent): QWidget(parent)
 {//initialise members with ideal vvalue
 
     chart= new Chart(graphType);
@@ -58,32 +51,26 @@ GraphDisplay::GraphDisplay(QString graphType, int ideal, QString inputMacAddress
     menu->addItem("an hour ago");
     menu->addItem("a day ago");
     menu->addItem("a week ago");
+    menu->addItem("a month ago");
+    menu->addItem("a year ago");
     chart->legend()->hide();
     chart->setAnimationOptions(QChart::AllAnimations);
 
     QObject::connect(menu,SIGNAL(currentIndexChanged(QString)),chart,SLOT(rangeSignal(QString)));
+    QObject::connect(menu,SIGNAL(currentIndexChanged(QString)),this,SLOT(rangeChangedSlot(QString)));
+    visibleSeconds=0;
     menu->show();
     graphView->show();
 
     chart->setIdeal(ideal);
     //data read initialise stuff
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-       connect(manager, SIGNAL(finished(QNetworkReply*)),
-               this, SLOT(graphDataFetchFinished(QNetworkReply*)));
-
-       QUrl url;
-       QByteArray postData;
-       url.setUrl("http://192.168.5.1:80/graph_data.php");
-       QNetworkRequest request(url);
-       request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
+    historyAddress = inputHistory;
+    connect(historyAddress, SIGNAL(historyChanged()), this, SLOT(historyChangedSlot()));
 
-       QString postKey = "mac";
-       QString postValue = inputMacAddress;
-       qDebug() << "this dodad";
-       qDebug() << inputMacAddress;
+    if(historyAddress->isLoaded())
+        historyChangedSlot();                                                   //Draw what is held straight away, the refresh adds only new rows
 
-       postData.append(postKey).append("=").append(postValue).append("&");
-       manager->post(request,postData);
+    historyAddress->refresh();
 
 }
 
@@ -101,29 +88,20 @@ GraphDisplay::GraphDisplay(QString graphType, int ideal, QWidget *parent): QWidg
     menu->addItem("an hour ago");
     menu->addItem("a day ago");
     menu->addItem("a week ago");
+    menu->addItem("a month ago");
+    menu->addItem("a year ago");
     chart->legend()->hide();
     chart->setAnimationOptions(QChart::AllAnimations);
 
     QObject::connect(menu,SIGNAL(currentIndexChanged(QString)),chart,SLOT(rangeSignal(QString)));
+    QObject::connect(menu,SIGNAL(currentIndexChanged(QString)),this,SLOT(rangeChangedSlot(QString)));
+    visibleSeconds=0;
     menu->show();
     graphView->show();
 
     chart->setIdeal(ideal);
     //data read initialise stuff
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-       connect(manager, SIGNAL(finished(QNetworkReply*)),
-               this, SLOT(graphDataFetchFinished(QNetworkReply*)));
-
-       QUrl url;
-       QByteArray postData;
-       url.setUrl("http://192.168.5.1:80/graph_data.php");
-       QNetworkRequest request(url);
-       request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-       QString postKey = "mac";
-       QString postValue = macAddress; 
-       postData.append(postKey).append("=").append(postValue).append("&");
-       manager->post(request,postData);
+    historyAddress = NULL;                                                      //No unit to read from
 
 }
 
@@ -142,61 +120,113 @@ void GraphDisplay::setIdeal(float ideal)// this setideal needs to call the chart
 }
 
 
-//SLOT FOR DATA RETURNED FROM NETWORK REQUEST
+//SLOT FOR THE UNIT HISTORY CHANGING
 
-void GraphDisplay:: graphDataFetchFinished(QNetworkReply* reply)
+void GraphDisplay::historyChangedSlot()
 {
-    reply->deleteLater();
-    QByteArray data_reply = reply->readAll();
-    QString dataString(data_reply);
-   QStringList points_list = dataString.split( "," );
-   QStringList points_div_ten;
-   for(int i=0;i<points_list.count();i++)
-   if(points_list[i].isEmpty())
-   {
-       points_list.takeAt(i);
-   }
-   for(int i=0;i<points_list.count();i++)
-   {
-        qDebug()<< points_list[i];
-   }
-
-   int i=0;
+    if(!historyAddress)
+        return;
+
+    TraceSpan span("graph update", "ui", historyAddress->getMacAddress());
+
+    QElapsedTimer updateClock;
+    updateClock.start();
+
+    const SensorRecords &records = historyAddress->records();
+
+    SensorRecords::Channel channel = SensorRecords::LightLevel;
     if(chart->getGraphType()=="light")
     {
-        i=0;
+        channel = SensorRecords::LightLevel;
     }
     else if(chart->getGraphType()=="humidity")
     {
-         i=1;
+        channel = SensorRecords::AirHumidity;
     }
     else if(chart->getGraphType()=="moisture")
     {
-        i=2;
+        channel = SensorRecords::SoilMoisture;
     }
     if(chart->getGraphType()=="temperature")
     {
-        i=3;
+        channel = SensorRecords::Temperature;
     }
-    while(i<points_list.count())
+
+    double now = QDateTime::currentSecsSinceEpoch();
+    double rangeStart = visibleSeconds > 0 ? now - visibleSeconds : 0;
+    int rows = records.count();
+    int firstRow = records.firstRecordFrom(rangeStart);                         //Only rows inside the selected range are touched
+    QVector<QPointF> points;
+
+    //Finest level that keeps the range to a few hundred points: raw rows, then 10 minute, hourly and daily buckets
+    int level = -1;
+    if(rows - firstRow > maximumPlotPoints)
+        for(level = 0; level < UnitHistory::RollupLevelCount - 1; level++)
+        {
+            const SensorRollup &rollup = historyAddress->rollup((UnitHistory::RollupLevel)level);
+
+            if(rollup.count() - rollup.firstBucketFrom(rangeStart) <= maximumPlotPoints)
+                break;
+        }
+
+    if(level < 0)
     {
-        qDebug()<< points_list[i];
-        qint64 timeOfValue=QDateTime().currentDateTime().toMSecsSinceEpoch()-(points_list.count()/6-i/6)*60000;//check my arithmetic, this should find the date/time the datapoint was recorded
-        chart->addPoint(timeOfValue, ((points_list[i].toDouble())));
-    i+=6;
+        points.reserve(rows - firstRow);
+
+        for(int i = firstRow; i < rows; i++)
+        {
+            qint64 timeOfValue = records.recordedAt(i) * 1000;                     //Chart axis is in milliseconds
+            points.append(QPointF(timeOfValue, records.value(i, channel)));
+        }
     }
+    else
+    {
+        const SensorRollup &rollup = historyAddress->rollup((UnitHistory::RollupLevel)level);
+        int firstBucket = rollup.firstBucketFrom(rangeStart);
+        double previousMean = 0;
 
+        points.reserve(2 * (rollup.count() - firstBucket));
 
+        //Each bucket's low and high, ordered the way the line is heading so peaks and troughs both show
+        for(int b = firstBucket; b < rollup.count(); b++)
+        {
+            qint64 bucketStart = rollup.startTime(b) * 1000;
+            qint64 bucketMiddle = bucketStart + rollup.getBucketSeconds() * 500;
+            double mean = rollup.mean(b, channel);
+            bool risingFlag = (mean >= previousMean);
+
+            points.append(QPointF(bucketStart, risingFlag ? rollup.minimum(b, channel) : rollup.maximum(b, channel)));
+            points.append(QPointF(bucketMiddle, risingFlag ? rollup.maximum(b, channel) : rollup.minimum(b, channel)));
+
+            previousMean = mean;
+        }
+    }
+
+    chart->setPoints(points);                                                   //Replot from the shared columns in one go, nothing is kept per graph
+
+    MetricsRegistry::instance()->record("ui.graphUpdateMs", updateClock.nsecsElapsed() / 1e6);
 }
 
-//POINTS_LIST IS THE QStringList
-//could change this string to be a global variable in the class, whatever you need bro
-//points_list[0], [6], [12] ... are light level
-//points_list[1], [7], [13] ... are air humidity
-//points_list[2], [8], [14] ... are soil moisture
-//points_list[3], [9], [15] ... are temperature
-//points_list[4], [unnamedMacAddresses], [16] ... are water level
-//points_list[5], [11], [17] ... are battery level
+//UnitHistory holds every row of the pot, oldest first, as one column per channel:
+//light level, air humidity, soil moisture, temperature, water level and battery level
+
+void GraphDisplay::rangeChangedSlot(QString desiredstart)
+{
+    if(desiredstart=="an hour ago")
+        visibleSeconds=3600;
+    else if(desiredstart=="a day ago")
+        visibleSeconds=86400;
+    else if(desiredstart=="a week ago")
+        visibleSeconds=7*86400;
+    else if(desiredstart=="a month ago")
+        visibleSeconds=30*86400;
+    else if(desiredstart=="a year ago")
+        visibleSeconds=365*86400;
+    else
+        visibleSeconds=0;
+
+    historyChangedSlot();
+}
 
 
 void GraphDisplay::setMacAddress(QString inputMacAddress)
@@ -4,9 +4,7 @@
 #include <QWidget>
 #include <QComboBox>
 #include "chart.h"
-#include <QNetworkAccessManager>
-#include <QUrl>
-#include <qnetworkreply.h>
+#include "unithistory.h"
 
 
 class GraphDisplay : public QWidget
@@ -16,7 +14,7 @@ class GraphDisplay : public QWidget
 public:
     GraphDisplay(QString graphType, QWidget *parent = 0);
     GraphDisplay(QString graphType, int ideal, QWidget *parent = 0);
-    GraphDisplay(QString graphType, int ideal, QString inputMacAddress, QWidget *parent=0);
+    GraphDisplay(QString graphType, int ideal, UnitHistory* inputHistory, QWidget *parent=0);
     
 
     ~GraphDisplay();
@@ -27,11 +25,14 @@ public:
     void setIdeal(float ideal);
     
 public slots:
-    void graphDataFetchFinished(QNetworkReply* reply);
+    void historyChangedSlot();
+    void rangeChangedSlot(QString desiredstart);
 
 private:
     
     QString macAddress;
+    UnitHistory* historyAddress;                    //The unit's shared history, NULL when the graph has none
+    int visibleSeconds;                             //Length of the selected range, 0 until one is picked
     QComboBox *menu;
     Chart *chart;
 
@@ -1,11 +1,44 @@
 #include "mainwindow.h"
+#include "hubclient.h"
+#include "metricsregistry.h"
+#include "tracerecorder.h"
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QSettings>
 
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
+    a.setOrganizationName("BioBloom");                  //Names the QSettings store
+    a.setApplicationName("BioBloomControl");
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+
+    QCommandLineOption hubOption("hub-url", "Hub to talk to instead of hub/url, e.g. http://localhost:8080/ for HubStandIn.", "url");
+    parser.addOption(hubOption);
+    parser.process(a);
+
+    if(parser.isSet(hubOption))
+        HubClient::instance()->setHubUrl(QUrl::fromUserInput(parser.value(hubOption)));
+
+    TraceRecorder* trace = TraceRecorder::instance();                  //Trace timestamps count from here
+    qint64 constructionStart = trace->now();
+
     MainWindow w;
     w.show();
 
-    return a.exec();
+    trace->complete("main window", "startup", constructionStart);
+
+    int exitCode = a.exec();
+
+    QSettings settings;
+    QString metricsFile = settings.value("diagnostics/metricsFile").toString();       //Where time went, for runs nobody was watching
+
+    if(!metricsFile.isEmpty())
+        MetricsRegistry::instance()->writeJson(metricsFile);
+
+    trace->write();                                                    //Does nothing unless tracing was asked for
+
+    return exitCode;
 }
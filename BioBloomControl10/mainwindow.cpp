@@ -1,7 +1,9 @@
 /*                          Header File                         */
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
-#include "ui_unitribbon.h"
+#include <QShortcut>
+#include <QElapsedTimer>
+#include "tracerecorder.h"
 
 /*                   Constructor and Destructor                 */
 MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWindow)
@@ -18,18 +20,20 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
      */
 
     setupPushButtons();
+    setupUnitList();
+
+    diagnosticsWindowAddress = NULL;
+    connect(new QShortcut(QKeySequence("Ctrl+D"), this), SIGNAL(activated()), this, SLOT(diagnosticsShortcutSlot()));
 
-    //ownedUnits = new QStringList;
     //unnamedMacAddresseses = new QStringList;
-    imageForProfiles = new ConfigureWindow(NULL,NULL);
 
-    unitTotal = 0;
+    fleetControllerAddress = new FleetController(this);
+    connect(fleetControllerAddress, SIGNAL(unitCreated(BioBloomUnit*)), this, SLOT(unitCreatedSlot(BioBloomUnit*)));
+    connect(fleetControllerAddress, SIGNAL(unitReadingReceived(int)), this, SLOT(threadFinishSlot(int)));    //Window refreshes as soon as a reading lands
 
     qDebug() << "3";
 
-    connect(this, SIGNAL(macFindFinished()), this, SLOT(macFindFinishedSlot()));
-
-    loadPreexistingUnits();
+    fleetControllerAddress->start();                                                                 //Loads the pots ribbon_boot lists
 
     qDebug() << "8";
 
@@ -37,6 +41,10 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent), ui(new Ui::MainWi
 
 MainWindow::~MainWindow()
 {
+    fleetControllerAddress->stop();
+
+    delete diagnosticsWindowAddress;                                                                   //Top level window, not a child
+
     delete ui;
 }
 
@@ -46,22 +54,9 @@ void MainWindow::addButtonPressSlot()
 {
     qDebug() << "9";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(unnamedMacsFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-    url.setUrl("http://192.168.5.1:80/return_macs.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "pointless";
-    QString postValue = "1";
-
-    qDebug() << request.url();
-    postData.append(postKey).append("=").append(postValue).append("&");
-    manager->post(request,postData);
+    HubReply* reply = HubClient::instance()->returnMacs();
+    connect(reply, SIGNAL(finished(HubReply*)),
+            this, SLOT(unnamedMacsFinished(HubReply*)));
 
     qDebug() << "10";
 
@@ -74,172 +69,65 @@ void MainWindow::addButtonPressSlot()
 void MainWindow::threadFinishSlot(int unitNumber)
 {
     qDebug() << "threadFinishSlot" << unitNumber;
-    ribbonAddress[unitNumber]->updateData();
-    unitAddress[unitNumber]->windowAddress->updateData();
-}
 
-void MainWindow::macFindFinishedSlot()
-{
-    qDebug() << "7";
+    UnitWindowCache* windows = unitWindowCache.value(unitNumber);                                   //The model repaints the unit's row itself
 
-    for(int i = 0; i < ((ownedUnits.count())/3); i++)
+    if(windows)
     {
+        QElapsedTimer updateClock;
+        updateClock.start();
 
-        qDebug() << "6";
-
-        int macAddressLocation = 0+(3*unitTotal);
-        int profile = 1+(3*unitTotal);
-        int names = 2+(3*unitTotal);
-
-        QString debugString1;
-        QString debugString2;
-        QString debugString3;
-
-        unitAddress.append(new BioBloomUnit(this));                                                                                                            //Instance a new unit class
-        unitAddress[unitTotal]->setUnitNumber(unitTotal);
-
-        unitAddress[unitTotal]->setMacAddress((QString)ownedUnits.at(macAddressLocation));
-
-        if(((QString)ownedUnits.at(profile)) == "Default")
-            unitAddress[unitTotal]->setPlantProfileTemplate(imageForProfiles->plantProfile[0]);
-
-        else if(((QString)ownedUnits.at(profile)) == "Aloe Cactus")
-            unitAddress[unitTotal]->setPlantProfileTemplate(imageForProfiles->plantProfile[1]);
-
-        else if(((QString)ownedUnits.at(profile)) == "Spider Plant")
-            unitAddress[unitTotal]->setPlantProfileTemplate(imageForProfiles->plantProfile[2]);
-
-        else if(((QString)ownedUnits.at(profile)) == "Peace Lily")
-            unitAddress[unitTotal]->setPlantProfileTemplate(imageForProfiles->plantProfile[3]);
-
-        else if(((QString)ownedUnits.at(profile)) == "Venus Fly Trap")
-            unitAddress[unitTotal]->setPlantProfileTemplate(imageForProfiles->plantProfile[4]);
-        else
-            unitAddress[unitTotal]->setPlantProfileTemplate(imageForProfiles->plantProfile[0]);
+        windows->updateData();
 
-        unitAddress[unitTotal]->setPlantName((QString)ownedUnits.at(names));
-
-        qDebug() << unitAddress[unitTotal]->getMacAddress();
-        qDebug() << unitAddress[unitTotal]->getPlantName();
-        qDebug() << unitAddress[unitTotal]->unitPlantProfile->plantTypeName;
-
-        ribbonAddress.append(new UnitRibbon(unitAddress[unitTotal], this));                                                                                    //Instance a new unit ribbon class
-        ribbonAddress[unitTotal]->setRibbonNumber(unitTotal);
-
-        itemAddress.append(new QListWidgetItem(ui->UnitList));                                                                                                 //Instance a new list widget item
-
-        itemAddress[unitTotal]->setSizeHint(ribbonAddress[unitTotal]->size());                                                                                 //Let list widget item know about size of unit ribbon
-        ui->UnitList->setItemWidget(itemAddress[unitTotal], ribbonAddress[unitTotal]);                                                                        //Set the unit ribbon in the list widget item
-        ui->UnitList->addItem(itemAddress[unitTotal]);                                                                                                       //Add the item to the list
-
-        connect(ribbonAddress[unitTotal]->ui->RibbonButton, SIGNAL(released()), unitAddress[unitTotal], SLOT(unitRibbonPressSlot()) );                          //Connect the unit ribbon button to the unitRibbonPressSlot of the unit class
-        connect(ribbonAddress[unitTotal]->ui->ConfigureButton, SIGNAL(released()), unitAddress[unitTotal], SLOT(unitRibbonConfigureButtonPressSlot()) );       //Connect the unit ribbon's configure button to the unitRibbonConfigureButtonPressSlot of the unit class
-
-        qDebug() << unitAddress[unitTotal]->unitPlantProfile->plantTypeName;
+        MetricsRegistry::instance()->record("ui.unitWindowUpdateMs", updateClock.nsecsElapsed() / 1e6);
+    }
+}
 
-        ribbonAddress[unitTotal]->updateData();
+void MainWindow::diagnosticsShortcutSlot()
+{
+    if(!diagnosticsWindowAddress)
+        diagnosticsWindowAddress = new DiagnosticsWindow;
 
-        qDebug() << "Ribbon Name" << ribbonAddress[unitTotal]->ui->plantTypeLabel->text();
+    diagnosticsWindowAddress->show();
+    diagnosticsWindowAddress->raise();
+}
 
-        unitWorkerAddress.append(new UnitWorker(unitAddress[unitTotal]));                                                                       //Instance a new worker for the unit
-        unitThreadAddress.append(new QThread);                                                                                                 //Instance a new thread for the worker
+void MainWindow::unitRibbonPressedSlot(int row)
+{
+    UnitWindowCache* windows = unitWindowCache.value(row);
 
-        unitWorkerAddress[unitTotal]->moveToThread(unitThreadAddress[unitTotal]);                                                               //Move the unit's worker to the unit's thread
+    if(windows)
+        windows->getUnitWindow()->show();
+}
 
-        connect(unitWorkerAddress[unitTotal], SIGNAL(error(QString)), this, SLOT(errorString(QString)));
-        connect(unitThreadAddress[unitTotal], SIGNAL(started()), unitWorkerAddress[unitTotal], SLOT(process()));
-        connect(unitWorkerAddress[unitTotal], SIGNAL(finished()), unitThreadAddress[unitTotal], SLOT(quit()));
-        connect(unitWorkerAddress[unitTotal], SIGNAL(finished()), unitWorkerAddress[unitTotal], SLOT(deleteLater()));
-        connect(unitThreadAddress[unitTotal], SIGNAL(finished()), unitThreadAddress[unitTotal], SLOT(deleteLater()));
+void MainWindow::unitConfigurePressedSlot(int row)
+{
+    UnitWindowCache* windows = unitWindowCache.value(row);
 
-        connect(unitWorkerAddress[unitTotal], SIGNAL(finishedSignal(int)), this, SLOT(threadFinishSlot(int)));
-        connect(unitWorkerAddress[unitTotal], SIGNAL(finishedSignal(int)), this, SLOT(updateDatabaseSlot(int)));
-        connect(unitWorkerAddress[unitTotal], SIGNAL(databaseDataRequest()), unitAddress[unitTotal], SLOT(dataRequestProcessSlot()));
-        connect(unitWorkerAddress[unitTotal], SIGNAL(networkPostSignal(QNetworkRequest, QByteArray)), unitAddress[unitTotal], SLOT(threadNetworkPostSlot(QNetworkRequest, QByteArray)) );
+    if(windows)
+        windows->getConfigureWindow()->show();
+}
 
-        unitThreadAddress[unitTotal]->start();
+void MainWindow::unitCreatedSlot(BioBloomUnit* unit)
+{
+    unitListModel->addUnit(unit);                                                                     //Row number matches the unit number
 
-        unitTotal += 1;
-    }
+    unitWindowCache.resize(qMax(unitWindowCache.count(), unit->getUnitNumber() + 1));
+    unitWindowCache[unit->getUnitNumber()] = new UnitWindowCache(unit);
 }
 
 void MainWindow::unknownMacProcessSlot(QString mac)
 {
     qDebug() << "17";
     qDebug() << mac;
-    
-    qDebug() << ownedUnitsMacAddresses[0];
-    ownedUnitsMacAddresses.append(mac);
-
-    unitAddress.append(new BioBloomUnit(this));                                                                                                            //Instance a new unit class
-    unitAddress[unitTotal]->setUnitNumber(unitTotal);
-    unitAddress[unitTotal]->setMacAddress(mac);
 
     qDebug() << "18";
 
-    unitAddress[unitTotal]->setPlantName("Unnamed");
-    unitAddress[unitTotal]->setPlantProfileTemplate(imageForProfiles->plantProfile[0]);
+    fleetControllerAddress->createUnit(mac, "Unnamed", PlantProfileCatalog::instance()->defaultProfile());
 
     qDebug() << "19";
 
-    ribbonAddress.append(new UnitRibbon(unitAddress[unitTotal], this));                                                                                    //Instance a new unit ribbon class
-    ribbonAddress[unitTotal]->setRibbonNumber(unitTotal);
-
-    itemAddress.append(new QListWidgetItem(ui->UnitList));                                                                                                 //Instance a new list widget item
-
-    itemAddress[unitTotal]->setSizeHint(ribbonAddress[unitTotal]->size());                                                                                 //Let list widget item know about size of unit ribbon
-    ui->UnitList->setItemWidget(itemAddress[unitTotal], ribbonAddress[unitTotal]);                                                                        //Set the unit ribbon in the list widget item
-    ui->UnitList->addItem(itemAddress[unitTotal]);                                                                                                       //Add the item to the list
-
-    connect(ribbonAddress[unitTotal]->ui->RibbonButton, SIGNAL(released()), unitAddress[unitTotal], SLOT(unitRibbonPressSlot()) );                          //Connect the unit ribbon button to the unitRibbonPressSlot of the unit class
-    connect(ribbonAddress[unitTotal]->ui->ConfigureButton, SIGNAL(released()), unitAddress[unitTotal], SLOT(unitRibbonConfigureButtonPressSlot()) );       //Connect the unit ribbon's configure button to the unitRibbonConfigureButtonPressSlot of the unit class
-
-    
-    unitAddress[unitTotal]->setPlantProfileTemplate(unitAddress[unitTotal]->configureWindowAddress->plantProfile[0]);
-
-    ribbonAddress[unitTotal]->updateData();
-    
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/personalise_plant.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postValue = mac;
-    QString postKey2 = "name";
-    QString postValue2 = "Unnamed";
-    QString postKey3 = "profile";
-    QString postValue3 = imageForProfiles->plantProfile[0]->plantTypeName;
-
-    postData.append(postKey).append("=").append(postValue).append("&").append(postKey2).append("=").append(postValue2).append("&").append(postKey3).append("=").append(postValue3).append("&");
-    manager->post(request,postData);
-    
-
-    unitWorkerAddress.append(new UnitWorker(unitAddress[unitTotal]));                                                                       //Instance a new worker for the unit
-    unitThreadAddress.append(new QThread);                                                                                                 //Instance a new thread for the worker
-
-    unitWorkerAddress[unitTotal]->moveToThread(unitThreadAddress[unitTotal]);                                                               //Move the unit's worker to the unit's thread
-
-    connect(unitWorkerAddress[unitTotal], SIGNAL(error(QString)), this, SLOT(errorString(QString)));
-    connect(unitThreadAddress[unitTotal], SIGNAL(started()), unitWorkerAddress[unitTotal], SLOT(process()));
-    connect(unitWorkerAddress[unitTotal], SIGNAL(finished()), unitThreadAddress[unitTotal], SLOT(quit()));
-    connect(unitWorkerAddress[unitTotal], SIGNAL(finished()), unitWorkerAddress[unitTotal], SLOT(deleteLater()));
-    connect(unitThreadAddress[unitTotal], SIGNAL(finished()), unitThreadAddress[unitTotal], SLOT(deleteLater()));
-
-    connect(unitWorkerAddress[unitTotal], SIGNAL(finishedSignal(int)), this, SLOT(threadFinishSlot(int)));
-    connect(unitWorkerAddress[unitTotal], SIGNAL(finishedSignal(int)), this, SLOT(updateDatabaseSlot(int)));
-    connect(unitWorkerAddress[unitTotal], SIGNAL(databaseDataRequest()), unitAddress[unitTotal], SLOT(dataRequestProcessSlot()));
-    connect(unitWorkerAddress[unitTotal], SIGNAL(networkPostSignal(QNetworkRequest, QByteArray)), unitAddress[unitTotal], SLOT(threadNetworkPostSlot(QNetworkRequest, QByteArray)) );
-
-    unitThreadAddress[unitTotal]->start();
-
-    unitTotal += 1;
+    HubClient::instance()->personalisePlant(mac, "Unnamed", PlantProfileCatalog::instance()->defaultProfile()->plantTypeName);
 }
 
 void MainWindow::unknownMacFindFinishedSlot()
@@ -247,9 +135,8 @@ void MainWindow::unknownMacFindFinishedSlot()
     qDebug() << "14";
 
     for(int i=0;i< unnamedMacAddresses.count();i++)
-        for(int j=0;j< ownedUnitsMacAddresses.count();j++)
-            if(unnamedMacAddresses[i]== ownedUnitsMacAddresses[j])
-                return;
+        if(fleetControllerAddress->unitByMacAddress(unnamedMacAddresses[i]))
+            return;
 
     qDebug() << "15";
     
@@ -266,6 +153,20 @@ void MainWindow::unknownMacFindFinishedSlot()
 }
 
 /*                         Class Methods                      */
+void MainWindow::setupUnitList()
+{
+    unitListModel = new UnitListModel(this);
+    unitRibbonDelegate = new UnitRibbonDelegate(this);
+
+    ui->UnitList->setModel(unitListModel);
+    ui->UnitList->setItemDelegate(unitRibbonDelegate);
+    ui->UnitList->setUniformItemSizes(true);                                                          //Rows are never measured one by one
+    ui->UnitList->setEditTriggers(QAbstractItemView::NoEditTriggers);
+
+    connect(unitRibbonDelegate, SIGNAL(ribbonPressed(int)), this, SLOT(unitRibbonPressedSlot(int)));
+    connect(unitRibbonDelegate, SIGNAL(configurePressed(int)), this, SLOT(unitConfigurePressedSlot(int)));
+}
+
 void MainWindow::setupPushButtons()
 {
     connect(ui->AddButton, SIGNAL(released()), this, SLOT(addButtonPressSlot()) );
@@ -273,19 +174,16 @@ void MainWindow::setupPushButtons()
         connect(this, SIGNAL(foundUnknownMac(QString)), this, SLOT(unknownMacProcessSlot(QString)));
 }
 
-void MainWindow::unnamedMacsFinished(QNetworkReply* reply)
+void MainWindow::unnamedMacsFinished(HubReply* reply)
 {
     qDebug() << "11";
 
-    reply->deleteLater();
-    QByteArray data_reply = reply->readAll();
-    QString dataString(data_reply);
-   QStringList points_list = dataString.split( "," );
-   for(int i=0;i<points_list.count();i++)
-   if(points_list[i].isEmpty())
-   {
-       points_list.takeAt(i);
-   }
+    HubFieldReader fields(reply->data());
+    QLatin1String field;
+    QStringList points_list;
+
+    while(fields.next(field))
+        points_list.append(field);
 
    qDebug() << "12";
 
@@ -295,66 +193,3 @@ void MainWindow::unnamedMacsFinished(QNetworkReply* reply)
 
    emit unknownMacFindFinished();
 }
-
-void MainWindow::loadPreexistingUnits()
-{
-    qDebug() << "1";
-
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(preexistingMacsFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-    url.setUrl("http://192.168.5.1:80/ribbon_boot.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "pointless";
-    QString postValue = "1";
-
-    qDebug() << request.url();
-    postData.append(postKey).append("=").append(postValue).append("&");
-    manager->post(request,postData);
-
-    qDebug() << "2";
-}
-
-void MainWindow::preexistingMacsFinished(QNetworkReply* reply)
-{
-    qDebug() << "4";
-
-    reply->deleteLater();
-    QByteArray data_reply = reply->readAll();
-    QString dataString(data_reply);
-   QStringList points_list = dataString.split( "," );
-   QStringList macs_list;
-   QString temp_macs;
-   
-   qDebug() << "2";
-   
-   for(int i=0;i<points_list.count();i++)
-       if(points_list[i].isEmpty())
-       {
-           points_list.takeAt(i);
-       }
-   for(int i=0;i<points_list.count();i++)
-       qDebug()<< points_list[i];
-
-   qDebug() << "1";
-   
-   for (int i=0; i< points_list.count() ; i=i+3)
-   {
-       qDebug() << points_list[i];
-       ownedUnitsMacAddresses.append(points_list[i]);
-       macs_list << points_list[i];
-    }
-
-   ownedUnits = points_list;
-   ownedUnitsMacAddresses = macs_list;
-   replyImage = reply;
-
-   qDebug() << "5";
-
-   emit macFindFinished();
-}
@@ -1,21 +1,26 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
-#include <QListWidgetItem>
 #include <QList>
 #include <QVector>
 #include <QMainWindow>
 #include <QPushButton>
-#include <QtNetwork\QNetworkAccessManager>
-#include <QUrl>
-#include <QUrlQuery>
-#include <QThread>
+#include <QTimer>
+#include <QHash>
+#include <QSettings>
 #include "biobloomunit.h"
 #include "settingswindow.h"
 #include "plantprofile.h"
-#include "unitworker.h"
+#include "plantprofilecatalog.h"
+#include "fleetcontroller.h"
+#include "unitwindowcache.h"
+#include "unitlistmodel.h"
+#include "unitribbondelegate.h"
 #include "configurewindow.h"
-#include <QNetworkReply>
+#include "hubclient.h"
+#include "hubfieldreader.h"
+#include "metricsregistry.h"
+#include "diagnosticswindow.h"
 #include <QDebug>
 #include <QStringList>
 
@@ -30,40 +35,34 @@ public:
     explicit MainWindow(QWidget *parent = 0);
     ~MainWindow();
 
-    QVector<BioBloomUnit*> unitAddress;             //Vector storing all the units
-    QVector<UnitRibbon*> ribbonAddress;            //Vector storing all the ribbons
-    QVector<QListWidgetItem*> itemAddress;        //Vector storing the list items containing the ribbons
-    QVector<UnitWorker*> unitWorkerAddress;      //Vector storing the worker functions for the units
-    QVector<QThread*> unitThreadAddress;        //Vector storing the threads for the units
+    UnitListModel* unitListModel;                  //Every unit, one row each, in unit number order
+    UnitRibbonDelegate* unitRibbonDelegate;        //Paints the rows of UnitList as ribbons
     QStringList unnamedMacAddresses;
-    QStringList ownedUnits;
-    QStringList ownedUnitsMacAddresses;
     //QVector<QStrings> ownedUnitsMacAddressesVector;
 
-    QNetworkReply* replyImage;
-
-    int unitTotal;                                 //Number of units so far
-
-    ConfigureWindow* imageForProfiles;
+    FleetController* fleetControllerAddress;       //Units, polling and push updates, everything but the windows
+    QVector<UnitWindowCache*> unitWindowCache;     //Each unit's windows, by unit number
+    DiagnosticsWindow* diagnosticsWindowAddress;   //Ctrl+D, NULL until first opened
 
     /*
      * on program startup, append this with pot information from database
-     * fill scrollarea on MainWindow with UnitAddresses[i]->UnitRibbon
+     * fill UnitList on MainWindow through unitListModel
      * profit
      */
 
 public slots:
     void addButtonPressSlot();
     void threadFinishSlot(int unitNumber);
-    void unnamedMacsFinished(QNetworkReply* reply);
-    void preexistingMacsFinished(QNetworkReply* reply);
-    void macFindFinishedSlot();
+    void unitRibbonPressedSlot(int row);
+    void unitConfigurePressedSlot(int row);
+    void unnamedMacsFinished(HubReply* reply);
+    void unitCreatedSlot(BioBloomUnit* unit);
     void unknownMacProcessSlot(QString mac);
     //void updateDatabaseSlot(int inputUnitNumber);
     void unknownMacFindFinishedSlot();
+    void diagnosticsShortcutSlot();
 
 signals:
-    void macFindFinished();
     void foundUnknownMac(QString mac);
     void unknownMacFindFinished();
 
@@ -73,10 +72,10 @@ private:
 
     //void setupUnitAddresses();  //Reads data from SQL database and sets up units
     void setupPushButtons();
+    void setupUnitList();
 
 
     void updateRibbon(int ribbonNumber, int unitNumber);                                //NEEDS TO HAPPEN WHEN FINISHED SIGNAL OF THREAD IS EMITTED
-    void loadPreexistingUnits();
 };
 
 #endif // MAINWINDOW_H
@@ -14,6 +14,8 @@ MusicWindow::MusicWindow(BioBloomUnit* inputParentUnit, QWidget *parent) : QWidg
     volumeString.setNum(volume);
     ui->VolumeLabel->setText(volumeString);
 
+    volumeDebouncer = new CommandDebouncer(CommandDebouncer::Volume, parentUnitAddress->getMacAddress(), this);      //One volume_request per burst of presses
+
     setupSongList();
     setupPushButtonFunctions();
 
@@ -46,31 +48,12 @@ void MusicWindow::backButtonPressSlot()
 
 void MusicWindow::volumeUpButtonPressSlot()
 {
-    //if(volumeButtonPressedRecently)
-    
     if(volume < 30)
     {       
         ++volume;
         volumeString.setNum(volume);
         
-        QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-        connect(manager, SIGNAL(finished(QNetworkReply*)),
-                this, SLOT(replyFinished(QNetworkReply*)));
-        
-        QUrl url;
-        QByteArray postData;
-        
-        url.setUrl("http://192.168.5.1:80/volume_request.php");
-        QNetworkRequest request(url);
-        request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-        
-        QString postKey = "mac";
-        QString postKey2 = "volume";
-        
-        postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(volumeString).append("&");
-        manager->post(request,postData);
-        
-        bool volumeButtonPressedRecently = 1;
+        volumeDebouncer->submit(QStringList(volumeString));
     }
     volumeString.setNum(volume);
     ui->VolumeLabel->setText(volumeString);
@@ -83,23 +66,7 @@ void MusicWindow::volumeDownButtonPressSlot()
         --volume;
     volumeString.setNum(volume);
 
-
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/volume_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "volume";
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(volumeString).append("&");
-    manager->post(request,postData);
+    volumeDebouncer->submit(QStringList(volumeString));
     }
     volumeString.setNum(volume);
     ui->VolumeLabel->setText(volumeString);
@@ -109,24 +76,7 @@ void MusicWindow::volumeDownButtonPressSlot()
 void MusicWindow::pauseButtonPressSlot()
 {
     QString actionID = "pause_play";
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/action_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "id";
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(actionID).append("&");
-    manager->post(request,postData);
+    HubClient::instance()->actionRequest(parentUnitAddress->getMacAddress(), actionID);
 
     if(pauseFlag == 0)
         pauseFlag = 1;
@@ -404,26 +354,6 @@ void MusicWindow::performAudioRequest(QString trackNumber)
 
     volumeString.setNum(volume);
     ui->VolumeLabel->setText(volumeString);
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/audio_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "track";
-    QString postKey3 = "volume";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(trackNumber).append("&").append(postKey3).append("=").append(volumeString).append("&");
-    manager->post(request,postData);
-
 
+    HubClient::instance()->audioRequest(parentUnitAddress->getMacAddress(), trackNumber, volumeString);
 }
@@ -2,10 +2,14 @@
 #define MUSICWINDOW_H
 
 #include <QWidget>
+#include <QPushButton>
+#include <QListWidgetItem>
+#include <QVector>
 #include <QIcon>
 #include <Qsize>
-#include <QNetworkAccessManager>
 #include "biobloomunit.h"
+#include "hubclient.h"
+#include "commanddebouncer.h"
 
 namespace Ui {class MusicWindow;}
 
@@ -50,6 +54,7 @@ public slots:
 private:
     Ui::MusicWindow *ui;
     BioBloomUnit* parentUnitAddress;
+    CommandDebouncer* volumeDebouncer;                  //Label follows every press, the pot only hears the last
 
     QVector<QPushButton*> songButtonAddress;
     QVector<QListWidgetItem*> songItemAddress;
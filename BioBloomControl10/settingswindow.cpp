@@ -11,6 +11,8 @@ SettingsWindow::SettingsWindow(BioBloomUnit* inputParentUnit, QWidget *parent) :
     WindowPalette.setColor(QPalette::Background, Qt::white);                                   //Configure the palette to fill the background with white
     this->setPalette(WindowPalette);                                                          //Set the palette
 
+    rgbDebouncer = new CommandDebouncer(CommandDebouncer::Rgb, parentUnitAddress->getMacAddress(), this);
+
     setupPushButtons();
 }
 
@@ -61,27 +63,7 @@ void SettingsWindow::redLEDButtonPressSlot()
     QString g = "0";
     QString b = "0";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/rgb_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "r";
-    QString postKey3 = "g";
-    QString postKey4 = "b";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(r).append("&").append(postKey3).append("=").append(g).append("&").append(postKey4).append("=").append(b).append("&");
-    manager->post(request,postData);
+    performRgbRequest(r, g, b);
 }
 
 void SettingsWindow::greenLEDButtonPressSlot()
@@ -91,27 +73,7 @@ void SettingsWindow::greenLEDButtonPressSlot()
     QString g = "1";
     QString b = "0";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/rgb_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "r";
-    QString postKey3 = "g";
-    QString postKey4 = "b";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(r).append("&").append(postKey3).append("=").append(g).append("&").append(postKey4).append("=").append(b).append("&");
-    manager->post(request,postData);
+    performRgbRequest(r, g, b);
 }
 
 void SettingsWindow::blueLEDButtonPressSlot()
@@ -121,27 +83,7 @@ void SettingsWindow::blueLEDButtonPressSlot()
     QString g = "0";
     QString b = "1";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/rgb_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "r";
-    QString postKey3 = "g";
-    QString postKey4 = "b";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(r).append("&").append(postKey3).append("=").append(g).append("&").append(postKey4).append("=").append(b).append("&");
-    manager->post(request,postData);
+    performRgbRequest(r, g, b);
 }
 
 void SettingsWindow::magentaLEDButtonPressSlot()
@@ -151,27 +93,7 @@ void SettingsWindow::magentaLEDButtonPressSlot()
     QString g = "0";
     QString b = "1";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/rgb_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "r";
-    QString postKey3 = "g";
-    QString postKey4 = "b";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(r).append("&").append(postKey3).append("=").append(g).append("&").append(postKey4).append("=").append(b).append("&");
-    manager->post(request,postData);
+    performRgbRequest(r, g, b);
 }
 
 void SettingsWindow::cyanLEDButtonPressSlot()
@@ -181,27 +103,7 @@ void SettingsWindow::cyanLEDButtonPressSlot()
     QString g = "1";
     QString b = "1";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/rgb_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "r";
-    QString postKey3 = "g";
-    QString postKey4 = "b";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(r).append("&").append(postKey3).append("=").append(g).append("&").append(postKey4).append("=").append(b).append("&");
-    manager->post(request,postData);
+    performRgbRequest(r, g, b);
 }
 
 void SettingsWindow::yellowLEDButtonPressSlot()
@@ -211,27 +113,7 @@ void SettingsWindow::yellowLEDButtonPressSlot()
     QString g = "1";
     QString b = "0";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/rgb_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "r";
-    QString postKey3 = "g";
-    QString postKey4 = "b";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(r).append("&").append(postKey3).append("=").append(g).append("&").append(postKey4).append("=").append(b).append("&");
-    manager->post(request,postData);
+    performRgbRequest(r, g, b);
 }
 
 void SettingsWindow::whiteLEDButtonPressSlot()
@@ -241,27 +123,7 @@ void SettingsWindow::whiteLEDButtonPressSlot()
     QString g = "1";
     QString b = "1";
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/rgb_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "r";
-    QString postKey3 = "g";
-    QString postKey4 = "b";
-
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(r).append("&").append(postKey3).append("=").append(g).append("&").append(postKey4).append("=").append(b).append("&");
-    manager->post(request,postData);
+    performRgbRequest(r, g, b);
 }
 
 void SettingsWindow::toggleLEDButtonPressSlot()
@@ -275,8 +137,7 @@ void SettingsWindow::toggleLEDButtonPressSlot()
 
 void SettingsWindow::manualWaterButtonPressSlot()
 {
-    QString ActionID = "water";
-    performAction(ActionID); //waters the plant
+    parentUnitAddress->waterPlantSlot(); //waters the plant and lets the poller watch it closely
 }
 
 void SettingsWindow::toggleWaterButtonPressSlot()
@@ -311,24 +172,7 @@ void SettingsWindow::performAction(QString actionID)
     //qDebug()<< parentUnitAddress->getMacAddress();
     //qDebug() << actionID;
 
-    QNetworkAccessManager *manager = new QNetworkAccessManager(this);
-    connect(manager, SIGNAL(finished(QNetworkReply*)),
-            this, SLOT(replyFinished(QNetworkReply*)));
-
-    QUrl url;
-    QByteArray postData;
-
-    url.setUrl("http://192.168.5.1:80/action_request.php");
-    QNetworkRequest request(url);
-    request.setHeader(QNetworkRequest::ContentTypeHeader,"application/x-www-form-urlencoded");
-
-    QString postKey = "mac";
-    QString postKey2 = "id";
-
-
-
-    postData.append(postKey).append("=").append(parentUnitAddress->getMacAddress()).append("&").append(postKey2).append("=").append(actionID).append("&");
-    manager->post(request,postData);
+    HubClient::instance()->actionRequest(parentUnitAddress->getMacAddress(), actionID);
 
     // the action 'ID' needs to be:
     // "water" to tell the pot to water the plant //this will be based on the humidity readings
@@ -336,6 +180,11 @@ void SettingsWindow::performAction(QString actionID)
     // "mute" to tell the pot to mute all sound effects // this can be from the state of a toggle switch?
     //more may follow when and /if we need the actions
 }
+
+void SettingsWindow::performRgbRequest(QString r, QString g, QString b)
+{
+    rgbDebouncer->submit(QStringList() << r << g << b);
+}
 /*
 void SettingsWindow:: finished(QNetworkReply*){}
 void SettingsWindow:: replyFinished(QNetworkReply*){}
@@ -2,9 +2,10 @@
 #define SETTINGSWINDOW_H
 
 #include <QWidget>
-#include <QtNetwork/QNetworkAccessManager>
 #include <QDebug>
 #include "biobloomunit.h"
+#include "hubclient.h"
+#include "commanddebouncer.h"
 
 namespace Ui {class SettingsWindow;}
 
@@ -40,11 +41,13 @@ private:
     Ui::SettingsWindow *ui;
 
     BioBloomUnit* parentUnitAddress;
+    CommandDebouncer* rgbDebouncer;                     //Rapid colour changes send only the final colour
 
 
     /*              Member Methods                  */
     void setupPushButtons();
     void performAction(QString);
+    void performRgbRequest(QString r, QString g, QString b);
 };
 
 #endif // SETTINGSWINDOW_H
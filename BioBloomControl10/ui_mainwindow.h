@@ -14,7 +14,7 @@
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QButtonGroup>
 #include <QtWidgets/QHeaderView>
-#include <QtWidgets/QListWidget>
+#include <QtWidgets/QListView>
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QStatusBar>
@@ -26,7 +26,7 @@ class Ui_MainWindow
 {
 public:
     QWidget *centralWidget;
-    QListWidget *UnitList;
+    QListView *UnitList;
     QPushButton *AddButton;
     QStatusBar *statusBar;
 
@@ -39,7 +39,7 @@ public:
         MainWindow->setDockOptions(QMainWindow::AllowNestedDocks|QMainWindow::AllowTabbedDocks|QMainWindow::AnimatedDocks);
         centralWidget = new QWidget(MainWindow);
         centralWidget->setObjectName(QStringLiteral("centralWidget"));
-        UnitList = new QListWidget(centralWidget);
+        UnitList = new QListView(centralWidget);
         UnitList->setObjectName(QStringLiteral("UnitList"));
         UnitList->setGeometry(QRect(90, 0, 551, 451));
         AddButton = new QPushButton(centralWidget);
@@ -26,6 +26,7 @@ public:
     QPushButton *BackButton;
     QPushButton *MusicButton;
     QPushButton *SettingsButton;
+    QPushButton *RefreshButton;
     QListWidget *DataList;
     QPushButton *PlantName;
 
@@ -58,6 +59,14 @@ public:
         SettingsButton->setIcon(icon2);
         SettingsButton->setIconSize(QSize(85, 110));
         SettingsButton->setFlat(true);
+        RefreshButton = new QPushButton(UnitWindow);
+        RefreshButton->setObjectName(QStringLiteral("RefreshButton"));
+        RefreshButton->setGeometry(QRect(0, 300, 91, 101));
+        QFont font;
+        font.setFamily(QStringLiteral("Calibri"));
+        font.setPointSize(12);
+        RefreshButton->setFont(font);
+        RefreshButton->setFlat(true);
         DataList = new QListWidget(UnitWindow);
         DataList->setObjectName(QStringLiteral("DataList"));
         DataList->setGeometry(QRect(100, 190, 151, 280));
@@ -65,10 +74,10 @@ public:
         PlantName = new QPushButton(UnitWindow);
         PlantName->setObjectName(QStringLiteral("PlantName"));
         PlantName->setGeometry(QRect(100, 10, 171, 41));
-        QFont font;
-        font.setFamily(QStringLiteral("Calibri"));
-        font.setPointSize(20);
-        PlantName->setFont(font);
+        QFont font1;
+        font1.setFamily(QStringLiteral("Calibri"));
+        font1.setPointSize(20);
+        PlantName->setFont(font1);
         PlantName->setFlat(true);
 
         retranslateUi(UnitWindow);
@@ -85,6 +94,7 @@ public:
         BackButton->setText(QString());
         MusicButton->setText(QString());
         SettingsButton->setText(QString());
+        RefreshButton->setText(QApplication::translate("UnitWindow", "Refresh", nullptr));
         PlantName->setText(QApplication::translate("UnitWindow", "PlantName", nullptr));
     } // retranslateUi
 
@@ -0,0 +1,79 @@
+/*                  Header File                 */
+#include "unitlistmodel.h"
+
+/*               Class Constructor              */
+UnitListModel::UnitListModel(QObject *parent) : QAbstractListModel(parent)
+{
+}
+
+
+
+/*              Class Methods                   */
+void UnitListModel::addUnit(BioBloomUnit* inputUnit)
+{
+    int row = unitAddress.count();
+
+    beginInsertRows(QModelIndex(), row, row);
+    unitAddress.append(inputUnit);
+    endInsertRows();
+
+    connect(inputUnit, SIGNAL(sensorReadingReceived(int)), this, SLOT(unitChangedSlot(int)));
+    connect(inputUnit, SIGNAL(unitChanged(int)), this, SLOT(unitChangedSlot(int)));             //Renamed or given a new profile
+}
+
+BioBloomUnit* UnitListModel::unitAt(int row) const
+{
+    if(row < 0 || row >= unitAddress.count())
+        return NULL;
+
+    return unitAddress[row];
+}
+
+int UnitListModel::unitCount() const
+{
+    return unitAddress.count();
+}
+
+int UnitListModel::rowCount(const QModelIndex &parent) const
+{
+    if(parent.isValid())                                                           //Flat list, no children
+        return 0;
+
+    return unitAddress.count();
+}
+
+QVariant UnitListModel::data(const QModelIndex &index, int role) const
+{
+    BioBloomUnit* unit = unitAt(index.row());
+
+    if(!index.isValid() || !unit)
+        return QVariant();
+
+    switch(role)
+    {
+        case Qt::DisplayRole:
+            return unit->getPlantName();
+
+        case PlantTypeRole:
+            return unit->unitPlantProfile->plantTypeName;
+
+        case MacAddressRole:
+            return unit->getMacAddress();
+
+        default:
+            return QVariant();
+    }
+}
+
+
+
+/*               Class Slots                    */
+void UnitListModel::unitChangedSlot(int unitNumber)
+{
+    if(unitNumber < 0 || unitNumber >= unitAddress.count())
+        return;
+
+    QModelIndex changedIndex = index(unitNumber);
+
+    emit dataChanged(changedIndex, changedIndex);                                 //Only repainted if the row is on screen
+}
@@ -0,0 +1,48 @@
+/*      Define Header File      */
+#ifndef UNITLISTMODEL_H
+#define UNITLISTMODEL_H
+
+/*      Library Classes         */
+#include <QAbstractListModel>
+#include <QVector>
+
+#include "biobloomunit.h"
+
+/*
+ * The fleet as the main window's list sees it. Units are added in the order
+ * FleetController numbers them, so row n is the unit whose unit number is n.
+ * The model holds no widgets, so a row only costs anything while
+ * UnitRibbonDelegate is painting it. A row repaints when its unit reports a new
+ * reading. Units stay owned by the controller, the model only keeps the pointers.
+ */
+
+/*          Class Declarations          */
+class BioBloomUnit;
+class UnitListModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum UnitRole
+    {
+        PlantTypeRole = Qt::UserRole + 1,                        //Profile name, Qt::DisplayRole is the plant's own name
+        MacAddressRole
+    };
+
+    explicit UnitListModel(QObject *parent = nullptr);
+
+    void addUnit(BioBloomUnit* inputUnit);                      //Appended as the next row
+    BioBloomUnit* unitAt(int row) const;
+    int unitCount() const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+public slots:
+    void unitChangedSlot(int unitNumber);
+
+private:
+    QVector<BioBloomUnit*> unitAddress;
+};
+
+#endif // UNITLISTMODEL_H
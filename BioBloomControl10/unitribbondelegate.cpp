@@ -0,0 +1,100 @@
+/*                  Header File                 */
+#include "unitribbondelegate.h"
+#include "unitlistmodel.h"
+#include "tracerecorder.h"
+#include <QPainter>
+#include <QMouseEvent>
+#include <QApplication>
+
+/*              Ribbon Geometry                 */
+static const int ribbonWidth = 540;
+static const int ribbonHeight = 60;
+static const int configureButtonSize = 60;
+static const int textIndent = 10;
+
+/*               Class Constructor              */
+UnitRibbonDelegate::UnitRibbonDelegate(QObject *parent) : QStyledItemDelegate(parent)
+{
+    configureIcon = QPixmap(":/ConfigureButtonIcon.PNG").scaled(configureButtonSize - 6, configureButtonSize - 6, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+    plantNameFont.setPointSize(11);
+    plantNameFont.setBold(true);
+    plantTypeFont.setPointSize(11);
+
+    plantNameColour = QColor("#55aa00");
+    plantTypeColour = QColor("#aa0000");
+}
+
+
+
+/*              Class Methods                   */
+void UnitRibbonDelegate::paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    QStyleOptionViewItem itemOption(option);
+    initStyleOption(&itemOption, index);
+    itemOption.text.clear();                                                       //Only the background and selection come from the style
+
+    const QWidget* view = itemOption.widget;
+    QStyle* style = view ? view->style() : QApplication::style();
+    style->drawControl(QStyle::CE_ItemViewItem, &itemOption, painter, view);
+
+    QRect textRect = option.rect.adjusted(textIndent, 0, -configureButtonSize, 0);
+    int halfHeight = option.rect.height() / 2;
+
+    painter->save();
+
+    painter->setFont(plantNameFont);
+    painter->setPen(plantNameColour);
+    painter->drawText(QRect(textRect.left(), textRect.top(), textRect.width(), halfHeight),
+                      Qt::AlignLeft | Qt::AlignBottom, index.data(Qt::DisplayRole).toString());
+
+    painter->setFont(plantTypeFont);
+    painter->setPen(plantTypeColour);
+    painter->drawText(QRect(textRect.left(), textRect.top() + halfHeight, textRect.width(), halfHeight),
+                      Qt::AlignLeft | Qt::AlignTop, index.data(UnitListModel::PlantTypeRole).toString());
+
+    QRect iconRect = configureRect(option.rect);
+    painter->drawPixmap(iconRect.center().x() - configureIcon.width() / 2,
+                        iconRect.center().y() - configureIcon.height() / 2, configureIcon);
+
+    painter->restore();
+
+    static bool firstPaintFlag = true;
+
+    if(firstPaintFlag)                                                             //End of the launch critical path
+    {
+        firstPaintFlag = false;
+        TraceRecorder::instance()->instant("first ribbon painted", "startup", index.data(UnitListModel::MacAddressRole).toString());
+    }
+}
+
+QSize UnitRibbonDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const
+{
+    Q_UNUSED(option);
+    Q_UNUSED(index);
+
+    return QSize(ribbonWidth, ribbonHeight);
+}
+
+bool UnitRibbonDelegate::editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option, const QModelIndex &index)
+{
+    if(event->type() != QEvent::MouseButtonRelease)
+        return QStyledItemDelegate::editorEvent(event, model, option, index);
+
+    QMouseEvent* mouseEvent = static_cast<QMouseEvent*>(event);
+
+    if(mouseEvent->button() != Qt::LeftButton || !option.rect.contains(mouseEvent->pos()))
+        return false;
+
+    if(configureRect(option.rect).contains(mouseEvent->pos()))
+        emit configurePressed(index.row());
+    else
+        emit ribbonPressed(index.row());
+
+    return true;
+}
+
+QRect UnitRibbonDelegate::configureRect(const QRect &ribbonRect) const
+{
+    return QRect(ribbonRect.right() - configureButtonSize + 1, ribbonRect.top(), configureButtonSize, ribbonRect.height());
+}
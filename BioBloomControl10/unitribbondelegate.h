@@ -0,0 +1,44 @@
+/*      Define Header File      */
+#ifndef UNITRIBBONDELEGATE_H
+#define UNITRIBBONDELEGATE_H
+
+/*      Library Classes         */
+#include <QStyledItemDelegate>
+#include <QPixmap>
+#include <QFont>
+#include <QColor>
+
+/*
+ * Paints a UnitListModel row the way the old UnitRibbon widget looked: plant
+ * name over plant type on the left, configure button on the right. A click on
+ * the configure area emits configurePressed(), anywhere else ribbonPressed().
+ * Every row is the same size so the view never has to measure them.
+ */
+
+/*          Class Declarations          */
+class UnitRibbonDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+public:
+    explicit UnitRibbonDelegate(QObject *parent = nullptr);
+
+    void paint(QPainter *painter, const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+    bool editorEvent(QEvent *event, QAbstractItemModel *model, const QStyleOptionViewItem &option, const QModelIndex &index) override;
+
+signals:
+    void ribbonPressed(int row);
+    void configurePressed(int row);
+
+private:
+    QPixmap configureIcon;                                      //Scaled once, not per paint
+    QFont plantNameFont;
+    QFont plantTypeFont;
+    QColor plantNameColour;
+    QColor plantTypeColour;
+
+    QRect configureRect(const QRect &ribbonRect) const;
+};
+
+#endif // UNITRIBBONDELEGATE_H
@@ -19,14 +19,22 @@ UnitWindow::UnitWindow(BioBloomUnit *inputParentUnit, QWidget *parent) : QWidget
 
 UnitWindow::~UnitWindow()
 {
+    delete musicWindowAddress;                                                                      //Top level windows, not children of this one
+    delete settingsWindowAddress;
     delete ui;
 }
 
+bool UnitWindow::isInUse()
+{
+    return isVisible() || (musicWindowAddress && musicWindowAddress->isVisible()) || (settingsWindowAddress && settingsWindowAddress->isVisible());
+}
+
 /*              Class Method Definitions            */
 void UnitWindow::setupOtherWindows()
 {
-    musicWindowAddress = new MusicWindow(parentUnitAddress);
-    settingsWindowAddress = new SettingsWindow(parentUnitAddress);
+    musicWindowAddress = NULL;                                                                      //Built the first time their buttons are pressed
+    settingsWindowAddress = NULL;
+    graphAddress = NULL;
 }
 
 void UnitWindow::setupDataDisplay()
@@ -72,6 +80,7 @@ void UnitWindow::setupPushButtonFunctions()
     connect(ui->BackButton, SIGNAL(released()), this, SLOT(backButtonPressSlot()) );
     connect(ui->MusicButton, SIGNAL(released()), this, SLOT(musicButtonPressSlot()) );
     connect(ui->SettingsButton, SIGNAL(released()), this, SLOT(settingsButtonPressSlot()) );
+    connect(ui->RefreshButton, SIGNAL(released()), parentUnitAddress, SLOT(refreshButtonPressSlot()) );    //Same completion driven path the scheduler uses, ahead of it
 
     connect(tempRibbonAddress->ui->RibbonButton, SIGNAL(released()), this, SLOT(tempRibbonPressSlot()) );
     connect(lightRibbonAddress->ui->RibbonButton, SIGNAL(released()), this, SLOT(lightRibbonPressSlot()) );
@@ -82,6 +91,14 @@ void UnitWindow::setupPushButtonFunctions()
 void UnitWindow::updateData()
 {
     ui->PlantName->setText(parentUnitAddress->getPlantName());
+
+    if(!parentUnitAddress->readingReceivedFlag)
+        return;
+
+    tempRibbonAddress->changeDataNumber(QString::number(parentUnitAddress->getCurrentTemp()));
+    lightRibbonAddress->changeDataNumber(QString::number(parentUnitAddress->getCurrentLight()));
+    moistureRibbonAddress->changeDataNumber(QString::number(parentUnitAddress->getCurrentMoisture()));
+    humidityRibbonAddress->changeDataNumber(QString::number(parentUnitAddress->getCurrentHumidity()));
 }
 
 /*              Class Slot Definitions              */
@@ -92,17 +109,24 @@ void UnitWindow::backButtonPressSlot()
 
 void UnitWindow::musicButtonPressSlot()
 {
+    if(!musicWindowAddress)
+        musicWindowAddress = new MusicWindow(parentUnitAddress);
+
     musicWindowAddress->show();
 }
 
 void UnitWindow::settingsButtonPressSlot()
 {
+    if(!settingsWindowAddress)
+        settingsWindowAddress = new SettingsWindow(parentUnitAddress);
+
     settingsWindowAddress->show();
 }
 
 void UnitWindow::tempRibbonPressSlot()
 {
-    graphAddress = new GraphDisplay("temperature", 28,parentUnitAddress->getMacAddress(), this);
+    delete graphAddress;                                                                            //Only one graph is shown at a time
+    graphAddress = new GraphDisplay("temperature", 28,parentUnitAddress->historyAddress, this);
     graphAddress->setMacAddress(parentUnitAddress->getMacAddress());
     
 
@@ -125,7 +149,8 @@ void UnitWindow::tempRibbonPressSlot()
 
 void UnitWindow::lightRibbonPressSlot()
 {
-    graphAddress = new GraphDisplay("light", 70,parentUnitAddress->getMacAddress(), this);
+    delete graphAddress;                                                                            //Only one graph is shown at a time
+    graphAddress = new GraphDisplay("light", 70,parentUnitAddress->historyAddress, this);
     //graphAddress->setMacAddress(parentUnitAddress->getMacAddress());
 
     //put graph in place
@@ -147,7 +172,8 @@ void UnitWindow::lightRibbonPressSlot()
 
 void UnitWindow::moistureRibbonPressSlot()
 {
-    graphAddress = new GraphDisplay("moisture", 70, parentUnitAddress->getMacAddress(), this);
+    delete graphAddress;                                                                            //Only one graph is shown at a time
+    graphAddress = new GraphDisplay("moisture", 70, parentUnitAddress->historyAddress, this);
     graphAddress->setMacAddress(parentUnitAddress->getMacAddress());
     
 
@@ -170,7 +196,8 @@ void UnitWindow::moistureRibbonPressSlot()
 
 void UnitWindow::humidityRibbonPressSlot()
 {
-    graphAddress = new GraphDisplay("humidity", 70, parentUnitAddress->getMacAddress(),this);
+    delete graphAddress;                                                                            //Only one graph is shown at a time
+    graphAddress = new GraphDisplay("humidity", 70, parentUnitAddress->historyAddress,this);
     graphAddress->setMacAddress(parentUnitAddress->getMacAddress());
     
 
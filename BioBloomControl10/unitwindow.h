@@ -28,6 +28,7 @@ public:
     ~UnitWindow();
 
     void updateData();
+    bool isInUse();                                     //This window, or the music or settings window it opened, is showing
 
 public slots:
     void backButtonPressSlot();
@@ -0,0 +1,87 @@
+/*                  Header File                 */
+#include "unitwindowcache.h"
+#include <QSettings>
+#include "tracerecorder.h"
+
+/*          Constructor and Destructor          */
+UnitWindowCache::UnitWindowCache(BioBloomUnit* inputParentUnit) : QObject(inputParentUnit), parentUnitAddress(inputParentUnit)
+{
+    windowAddress = NULL;                                                         //Windows are built when first opened, see getUnitWindow()
+    configureWindowAddress = NULL;
+
+    QSettings settings;
+    windowReleaseInterval = settings.value("windows/releaseAfterMinutes", 0).toInt() * 60000;
+
+    windowReleaseTimer = new QTimer(this);
+    windowReleaseTimer->setSingleShot(true);
+    windowReleaseTimer->setTimerType(Qt::VeryCoarseTimer);
+    connect(windowReleaseTimer, SIGNAL(timeout()), this, SLOT(windowReleaseSlot()));
+}
+
+UnitWindowCache::~UnitWindowCache()
+{
+    delete windowAddress;                                                         //Top level windows, not children of the cache
+    delete configureWindowAddress;
+}
+
+
+
+/*              Class Methods                   */
+UnitWindow* UnitWindowCache::getUnitWindow()
+{
+    if(!windowAddress)
+    {
+        TraceSpan span("unit window", "window", parentUnitAddress->getMacAddress());
+
+        windowAddress = new UnitWindow(parentUnitAddress);
+        windowAddress->updateData();                                              //Readings that came in while it did not exist
+    }
+
+    restartWindowReleaseTimer();
+
+    return windowAddress;
+}
+
+ConfigureWindow* UnitWindowCache::getConfigureWindow()
+{
+    if(!configureWindowAddress)
+    {
+        TraceSpan span("configure window", "window", parentUnitAddress->getMacAddress());
+
+        configureWindowAddress = new ConfigureWindow(parentUnitAddress);
+    }
+
+    restartWindowReleaseTimer();
+
+    return configureWindowAddress;
+}
+
+void UnitWindowCache::updateData()
+{
+    if(windowAddress)                                                             //Windows that were never opened are filled in when they are
+        windowAddress->updateData();
+}
+
+void UnitWindowCache::restartWindowReleaseTimer()
+{
+    if(windowReleaseInterval > 0)
+        windowReleaseTimer->start(windowReleaseInterval);
+}
+
+
+
+/*               Class Slots                    */
+void UnitWindowCache::windowReleaseSlot()
+{
+    if((windowAddress && windowAddress->isInUse()) || (configureWindowAddress && configureWindowAddress->isVisible()))
+    {
+        restartWindowReleaseTimer();                                              //Still being looked at, check again later
+        return;
+    }
+
+    delete windowAddress;
+    delete configureWindowAddress;
+
+    windowAddress = NULL;
+    configureWindowAddress = NULL;
+}
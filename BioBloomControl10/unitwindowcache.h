@@ -0,0 +1,49 @@
+/*      Define Header File      */
+#ifndef UNITWINDOWCACHE_H
+#define UNITWINDOWCACHE_H
+
+/*      Library Classes         */
+#include <QObject>
+#include <QTimer>
+
+#include "biobloomunit.h"
+#include "unitwindow.h"
+#include "configurewindow.h"
+
+/*
+ * Holds the windows of one BioBloomUnit, which knows nothing about them.
+ * Each window is built the first time it is asked for, and with
+ * windows/releaseAfterMinutes set both are freed again once nobody has looked
+ * at them for that long; everything they show lives in the unit, so they are
+ * simply rebuilt when next opened. Parented to its unit and gone with it.
+ */
+
+/*          Class Declarations          */
+class UnitWindowCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit UnitWindowCache(BioBloomUnit* inputParentUnit);
+    ~UnitWindowCache();
+
+    UnitWindow* getUnitWindow();                                //Builds the window on first use
+    ConfigureWindow* getConfigureWindow();
+    void updateData();                                          //Refreshes the unit window if it exists
+
+public slots:
+    void windowReleaseSlot();
+
+private:
+    BioBloomUnit* parentUnitAddress;
+
+    UnitWindow* windowAddress;                                  //Unit's personal window, NULL until first opened
+    ConfigureWindow* configureWindowAddress;                    //NULL until first opened
+
+    QTimer* windowReleaseTimer;                                 //Frees closed windows after a spell of not being used
+    int windowReleaseInterval;                                  //Milliseconds, 0 keeps windows for good
+
+    void restartWindowReleaseTimer();
+};
+
+#endif // UNITWINDOWCACHE_H
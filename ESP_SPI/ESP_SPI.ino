@@ -332,6 +332,7 @@ void setup() {
   delay(50);
   digitalWrite(5, LOW);
   sensor_info_request(); 
+  server.send(200, "text/plain", "OK"); //reading has been posted to the hub by now, lets data_request.php return straight away
   });
 
 
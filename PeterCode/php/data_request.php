@@ -1,24 +1,38 @@
 <?php
+//FILE CANNOT HAVE ANY ECHO STATEMENTS EXCEPT EXPECTED DATA
+//Pokes the pot for a reading, waits for the pot's sensor_data.php post to land,
+//then echoes the new row in the same format as recent_entry.php
+//echoes nothing if no new row arrives before the deadline
+
+include "sensor_records.php";
 
 $mac = $_POST["mac"];
 
-echo $mac;
-echo "   ";
+//echo $mac;
+//echo "   ";
 
 $database = new mysqli("localhost", "plant_connect", "teamholly", "BioBloom");
 
 if ($database->connect_error) {
     die("Connection failed: " . $database->connect_error);
-} 
+}
+
+//echo "\n";
+//echo "Connected successfully		";
 
-echo "\n";
-echo "Connected successfully		";
 
+$result = $database->query("SELECT id, local_ip FROM pot_details WHERE mac = '{$mac}'");
 
-$result = $database->query("SELECT local_ip FROM pot_details WHERE mac = '{$mac}'");
+$pot = $result->fetch_object();
+$id = $pot->id;
+$ip = $pot->local_ip;
+//echo $ip;
+
+//remember the newest row before asking so the new one can be recognised
+$rowSQL = $database->query("SELECT MAX( data_number ) AS max FROM sensor_data WHERE id = '{$id}'");
+$row = $rowSQL->fetch_assoc();
+$previous_number = $row['max'];
 
-$ip = $result->fetch_object()->local_ip;
-echo $ip;
 $url = 'http://' . $ip . ':4132/data_request';
 
 
@@ -26,12 +40,39 @@ $options = array(
     'http' => array(
         'header'  => "Content-type: application/x-www-form-urlencoded\r\n",
         'method'  => 'POST',
+        'timeout' => 3,
 
     )
 );
 $context  = stream_context_create($options);
 $go = file_get_contents($url, false, $context);
 
+//the pot posts its reading to sensor_data.php while handling the request, poll briefly in case it is still on its way
+$deadline = microtime(true) + 5;
+
+do {
+	$rowSQL = $database->query("SELECT MAX( data_number ) AS max FROM sensor_data WHERE id = '{$id}'");
+	$row = $rowSQL->fetch_assoc();
+	$largest_number = $row['max'];
+
+	if($largest_number !== NULL && $largest_number != $previous_number){
+		header("X-Last-Data-Number: " . intval($largest_number));
+		$recent = $database->query("SELECT light_level, air_humidity, soil_moisture, temperature, water_level, battery_level FROM sensor_data WHERE id = '{$id}' AND data_number = '{$largest_number}'");
+		if(records_wanted()) {
+			records_begin($recent->num_rows);
+			while($recent_row = $recent->fetch_assoc())
+				records_row($recent_row);
+		}
+		else
+		while($recent_row = $recent->fetch_assoc()) {
+			echo $recent_row[light_level] . "," . $recent_row[air_humidity]. "," . $recent_row[soil_moisture] . "," . $recent_row[temperature] . "," . $recent_row[water_level] . "," . $recent_row[battery_level];
+		}
+		break;
+	}
+
+	usleep(100000);
+} while(microtime(true) < $deadline);
+
 mysqli_close($database);
 
 ?>
\ No newline at end of file
@@ -0,0 +1,32 @@
+<?php
+//FILE CANNOT HAVE ANY ECHO STATEMENTS EXCEPT EXPECTED DATA
+//Returns the newest sensor row of every named pot in one reply so the client
+//does not have to ask recent_entry.php once per pot
+//each pot is echoed as mac,data_number,light_level,air_humidity,soil_moisture,temperature,water_level,battery_level,
+
+$database = new mysqli("localhost", "plant_connect", "teamholly", "BioBloom");
+
+if ($database->connect_error) {
+    die("Connection failed: " . $database->connect_error);
+}
+//echo "\n";
+//echo "Connected successfully		";
+
+//one pass over sensor_data finds the largest data_number of every pot, then the matching rows are joined back in
+$result = $database->query("SELECT pot_details.mac, sensor_data.data_number, sensor_data.light_level, sensor_data.air_humidity, sensor_data.soil_moisture, sensor_data.temperature, sensor_data.water_level, sensor_data.battery_level
+                            FROM pot_details
+                            JOIN (SELECT id, MAX(data_number) AS max FROM sensor_data GROUP BY id) AS newest ON newest.id = pot_details.id
+                            JOIN sensor_data ON sensor_data.id = newest.id AND sensor_data.data_number = newest.max
+                            WHERE pot_details.plant_name IS NOT NULL");
+
+if($result->num_rows > 0){
+
+	while($row = $result->fetch_assoc()) {
+			echo $row[mac] . "," . $row[data_number] . "," . $row[light_level] . "," . $row[air_humidity]. "," . $row[soil_moisture] . "," . $row[temperature] . "," . $row[water_level] . "," . $row[battery_level] . ",";
+		}
+}
+
+
+mysqli_close($database);
+
+?>
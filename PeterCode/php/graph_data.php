@@ -2,8 +2,13 @@
 //FILE CANNOT HAVE ANY ECHO STATEMENTS EXCEPT EXPECTED DATA
 //COMMENT OUT AFTER DEBUGGING IS COMPLETE
 
+include "sensor_records.php";
+
 $mac = $_POST["mac"];
 
+//optional cursor: only rows with a data_number above since are sent, so a client that already holds the history just gets what is new
+$since = isset($_POST["since"]) ? intval($_POST["since"]) : 0;
+
 
 
 //echo $mac;
@@ -24,14 +29,30 @@ $id_row = $info->fetch_assoc();
 $id = $id_row[id];
 //echo $id;
 
-$result = $database->query("SELECT light_level, air_humidity, soil_moisture, temperature, water_level, battery_level FROM sensor_data WHERE id = '{$id}'");
+//recorded_at is 0 for rows stored before the column was added, the client spaces those out itself
+$result = $database->query("SELECT data_number, recorded_at, light_level, air_humidity, soil_moisture, temperature, water_level, battery_level FROM sensor_data WHERE id = '{$id}' AND data_number > '{$since}' ORDER BY data_number");
+
+//hold the rows so the header can say exactly where this reply stopped, rows stored while it is being sent come next time
+$rows = array();
+while($row = $result->fetch_assoc())
+	$rows[] = $row;
 
-if($result->num_rows > 0){
+$last_number = count($rows) > 0 ? intval($rows[count($rows) - 1][data_number]) : $since;
+header("X-Last-Data-Number: " . $last_number);
+header("X-Record-Times: 1");
+
+if(records_wanted()) {
+	records_begin(count($rows), true);
+
+	foreach($rows as $row)
+		records_row($row);
+}
+else if(count($rows) > 0){
 	
-	while($row = $result->fetch_assoc()) {
+	foreach($rows as $row) {
 
 			//echo "light_level" . "," . $row[light_level] . "," . "air_humidity" . "," . $row[air_humidity]. "," . "soil_moisture".  "," . $row[soil_moisture] . "," . "temperature" . "," . $row[temperature] . "," . "water_level" . "," . $row[water_level] . "," . "battery_level" . "," . $row[battery_level];	
-			echo $row[light_level] . "," . $row[air_humidity]. "," . $row[soil_moisture] . "," . $row[temperature] . "," . $row[water_level] . "," . $row[battery_level] . ",";			
+			echo $row[recorded_at] . "," . $row[light_level] . "," . $row[air_humidity]. "," . $row[soil_moisture] . "," . $row[temperature] . "," . $row[water_level] . "," . $row[battery_level] . ",";			
 		}		
 }
 
@@ -2,6 +2,8 @@
 //FILE CANNOT HAVE ANY ECHO STATEMENTS EXCEPT EXPECTED DATA
 //COMMENT OUT AFTER DEBUGGING IS COMPLETE
 
+include "sensor_records.php";
+
 $mac = $_POST["mac"];
 
 
@@ -33,8 +35,17 @@ if($result->num_rows > 0){
 	$row = $rowSQL->fetch_assoc();
 	$largest_number = $row['max'];
 	//echo $largest_number;
+
+	//number the row so the client can tell it from one it already holds
+	header("X-Last-Data-Number: " . intval($largest_number));
 	
 $recent = $database->query("SELECT light_level, air_humidity, soil_moisture, temperature, water_level, battery_level FROM sensor_data WHERE id = '{$id}' AND data_number = '{$largest_number}'");
+		if(records_wanted()) {
+			records_begin($recent->num_rows);
+			while($recent_row = $recent->fetch_assoc())
+				records_row($recent_row);
+		}
+		else
 		while($recent_row = $recent->fetch_assoc()) {
 			//echo "light_level" . "," . $recent_row[light_level] . "," . "air_humidity" . "," . $recent_row[air_humidity]. "," . "soil_moisture".  "," . $recent_row[soil_moisture] . "," . "temperature" . "," . $recent_row[temperature] . "," . "water_level" . "," . $recent_row[water_level] . "," . "battery_level" . "," . $recent_row[battery_level];	
 			echo $recent_row[light_level] . "," . $recent_row[air_humidity]. "," . $recent_row[soil_moisture] . "," . $recent_row[temperature] . "," . $recent_row[water_level] . "," . $recent_row[battery_level];			
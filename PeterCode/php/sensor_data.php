@@ -55,8 +55,10 @@ $data_number =1;
 
 }
 
-//insert new row into table
-$database->query("INSERT INTO sensor_data (data_number, id, light_level, air_humidity, soil_moisture, temperature, water_level, battery_level) VALUES ('{$data_number}', '{$id}', '{$light_level}', '{$air_humidity}', '{$soil_moisture}', '{$temperature}', '{$water_level}', '{$battery_level}')");	
+//insert new row into table, stamped with when it arrived since pots report anywhere from every 15 seconds to every 10 minutes
+//needs: ALTER TABLE sensor_data ADD recorded_at INT UNSIGNED NOT NULL DEFAULT 0
+$recorded_at = time();
+$database->query("INSERT INTO sensor_data (data_number, id, recorded_at, light_level, air_humidity, soil_moisture, temperature, water_level, battery_level) VALUES ('{$data_number}', '{$id}', '{$recorded_at}', '{$light_level}', '{$air_humidity}', '{$soil_moisture}', '{$temperature}', '{$water_level}', '{$battery_level}')");	
 
 
 mysqli_close($database);
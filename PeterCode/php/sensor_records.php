@@ -0,0 +1,40 @@
+<?php
+//FILE CANNOT HAVE ANY ECHO STATEMENTS
+//Shared by recent_entry.php, graph_data.php and data_request.php
+//A client that sends "Accept: application/x-biobloom-records" gets sensor rows packed as binary instead of comma seperated text
+//
+//header, 8 bytes little-endian:  "BB", version (1 byte), channel mask (1 byte), record count (4 bytes)
+//then per record, when mask bit 64 is set, the unsigned 32 bit recorded_at in seconds since 1970,
+//followed by one signed 16 bit value in tenths for every channel set in the mask, lowest bit first
+//mask bits: 1 light_level, 2 air_humidity, 4 soil_moisture, 8 temperature, 16 water_level, 32 battery_level, 64 recorded_at
+
+$record_channels = array("light_level", "air_humidity", "soil_moisture", "temperature", "water_level", "battery_level");
+
+function records_wanted() {
+	return isset($_SERVER["HTTP_ACCEPT"]) && strpos($_SERVER["HTTP_ACCEPT"], "application/x-biobloom-records") !== false;
+}
+
+$record_times = false;
+
+function records_begin($count, $times = false) {
+	global $record_times;
+
+	$record_times = $times;
+	header("Content-Type: application/x-biobloom-records");
+	echo pack("a2CCV", "BB", 1, $times ? 0x7F : 0x3F, $count);
+}
+
+function records_row($row) {
+	global $record_channels, $record_times;
+
+	$packed = "";
+	if($record_times)
+		$packed .= pack("V", intval($row[recorded_at]));
+
+	foreach($record_channels as $channel)
+		$packed .= pack("v", intval($row[$channel]) & 0xFFFF);
+
+	echo $packed;
+}
+
+?>
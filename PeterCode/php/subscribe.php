@@ -0,0 +1,79 @@
+<?php
+//FILE CANNOT HAVE ANY ECHO STATEMENTS EXCEPT EXPECTED DATA
+//Long poll for new sensor rows
+//macs is a comma seperated list of pot mac addresses, since is the matching list of the newest data_number the client already has
+//the request is held open until any of those pots gets a newer row, or for 25 seconds
+//new rows are echoed in the fleet_snapshot.php format: mac,data_number,light_level,air_humidity,soil_moisture,temperature,water_level,battery_level,
+
+$macs = explode(",", $_POST["macs"]);
+$since = explode(",", $_POST["since"]);
+
+set_time_limit(40);
+
+$database = new mysqli("localhost", "plant_connect", "teamholly", "BioBloom");
+
+if ($database->connect_error) {
+    die("Connection failed: " . $database->connect_error);
+}
+
+//newest data_number the client has for each mac
+$cursor = array();
+$mac_list = array();
+for($i = 0; $i < count($macs); $i++) {
+	if($macs[$i] == "")
+		continue;
+	$cursor[$macs[$i]] = isset($since[$i]) ? intval($since[$i]) : 0;
+	$mac_list[] = "'" . $database->real_escape_string($macs[$i]) . "'";
+}
+
+if(count($mac_list) < 1) {
+	mysqli_close($database);
+	exit();
+}
+
+$mac_set = implode(",", $mac_list);
+
+//look the subscribed pots up once, every later query only touches their own rows
+$pots = $database->query("SELECT id, mac FROM pot_details WHERE mac IN ({$mac_set})");
+
+$id_cursor = array();
+$id_mac = array();
+while($pot = $pots->fetch_assoc()) {
+	$id = intval($pot[id]);
+	$id_cursor[$id] = $cursor[$pot[mac]];
+	$id_mac[$id] = $pot[mac];
+}
+
+if(count($id_cursor) < 1) {
+	mysqli_close($database);
+	exit();
+}
+
+$id_set = implode(",", array_keys($id_cursor));
+$deadline = microtime(true) + 25;
+
+do {
+	//MAX per id is read straight off the (id, data_number) key, one seek per pot
+	$newest = $database->query("SELECT id, MAX(data_number) AS max FROM sensor_data WHERE id IN ({$id_set}) GROUP BY id");
+
+	$fresh = array();
+	while($row = $newest->fetch_assoc()) {
+		if(intval($row[max]) > $id_cursor[intval($row[id])])
+			$fresh[] = "(id = " . intval($row[id]) . " AND data_number = " . intval($row[max]) . ")";
+	}
+
+	if(count($fresh) > 0) {
+		$result = $database->query("SELECT id, data_number, light_level, air_humidity, soil_moisture, temperature, water_level, battery_level FROM sensor_data WHERE " . implode(" OR ", $fresh));
+
+		while($row = $result->fetch_assoc()) {
+			echo $id_mac[intval($row[id])] . "," . $row[data_number] . "," . $row[light_level] . "," . $row[air_humidity]. "," . $row[soil_moisture] . "," . $row[temperature] . "," . $row[water_level] . "," . $row[battery_level] . ",";
+		}
+		break;
+	}
+
+	usleep(250000);
+} while(microtime(true) < $deadline);
+
+mysqli_close($database);
+
+?>